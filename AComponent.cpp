@@ -2,9 +2,9 @@
 // Dependencies
 ///////////////////////////////////////////////////////////////////////////////
 #include "AComponent.hpp"
+#include "Arena.hpp"
+#include "Snapshot.hpp"
 #include "Errors/OutOfRangePinException.hpp"
-#include <set>
-#include <queue>
 #include <string>
 #include <algorithm>
 
@@ -26,9 +26,14 @@ namespace nts
 
 ///////////////////////////////////////////////////////////////////////////////
 AComponent::AComponent(const std::string& name, size_t count)
-    : m_name(name)
-    , m_pins(count)
+    : m_name(name, Arena::getCurrent())
+    , m_pins(count, Arena::getCurrent())
     , m_tick(0)
+    , m_context(nullptr)
+    , m_index(Engines::NetTable::NONE)
+    , m_changed(false)
+    , m_owner(nullptr)
+    , m_ownerPins(Arena::getCurrent())
 {}
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -43,72 +48,202 @@ void AComponent::setLink(
     m_pins[pin].addLink(other, otherPin);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+void AComponent::setOwner(size_t pin, IComponent& owner, size_t ownerPin)
+{
+    if (pin >= m_pins.size())
+        throw OutOfRangePinException();
+    if (m_ownerPins.empty())
+        m_ownerPins.assign(m_pins.size(), Engines::NetTable::NONE);
+    m_owner = &owner;
+    m_ownerPins[pin] = static_cast<uint32_t>(ownerPin);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 void AComponent::simulate(size_t tick)
 {
     m_tick = tick;
+    m_changed = false;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Tristate64 AComponent::compute64(size_t)
+{
+    throw ComponentException(getName() + ": no bit-parallel model");
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void AComponent::evaluate(size_t epoch)
+{
+    for (size_t i = 0; i < m_pins.size(); i++) {
+        if (m_pins[i].getType() == Pin::Type::OUTPUT)
+            m_pins[i].setState(compute(i), epoch);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void AComponent::settle(size_t epoch)
+{
+    for (size_t i = 0; i < m_pins.size(); i++) {
+        if (m_pins[i].getType() == Pin::Type::OUTPUT
+            && !m_pins[i].isFresh(epoch))
+            m_pins[i].setState(compute(i), epoch);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void AComponent::setContext(Engines::Context* context)
+{
+    m_context = context;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void AComponent::setIndex(uint32_t index)
+{
+    m_index = index;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool AComponent::hasSideEffects(void) const
+{
+    return (false);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool AComponent::hasChanged(void) const
+{
+    return (m_changed);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void AComponent::saveState(Snapshot& snapshot) const
+{
+    snapshot.writeTick(m_tick);
+    for (const Pin& pin : m_pins)
+        snapshot.write(pin.getState());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void AComponent::loadState(Snapshot& snapshot)
+{
+    m_tick = snapshot.readTick();
+    for (Pin& pin : m_pins)
+        pin.setState(snapshot.read<Tristate>());
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 const std::string AComponent::getName(void) const
 {
-    return (m_name);
+    return (std::string(m_name));
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 void AComponent::propagateOutput(size_t pin, Tristate state)
 {
-    if (pin >= m_pins.size() && m_pins[pin].getType() == Pin::Type::INPUT)
+    if (pin >= m_pins.size() || m_pins[pin].getType() != Pin::Type::OUTPUT)
         throw ComponentException("Invalid output pin");
-    m_pins[pin].setState(state);
+    if (m_context && m_context->isLatching())
+        m_pins[pin].setState(state, m_context->getEpoch());
+    else
+        m_pins[pin].setState(state);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Tristate AComponent::getInputState(size_t pin)
+{
+    if (m_pins[pin].getType() == Pin::Type::ELECTRICAL)
+        return (Tristate::Undefined);
+    if (pin >= m_pins.size() || m_pins[pin].getType() == Pin::Type::OUTPUT)
+        throw ComponentException("Invalid input pin");
 
-    static std::queue<std::pair<std::weak_ptr<IComponent>, size_t>> uqueue;
+    auto [component, otherPin] = getDriver(pin);
+    if (!component)
+        return (Tristate::Undefined);
 
-    for (const auto& link : m_pins[pin].getLinks()) {
-        if (auto component = link.component.lock())
-            uqueue.push({link.component, link.pin});
-    }
+    Pin& source = component->getPins()[otherPin];
+    if (m_context && source.isFresh(m_context->getEpoch()))
+        return (source.getState());
+    if (m_context && source.isMemoized(m_context->getSweep()))
+        return (source.getMemo());
 
-    while (!uqueue.empty()) {
-        auto [weakComponent, componentPin] = uqueue.front();
-        uqueue.pop();
-        if (auto component = weakComponent.lock()) {
-            component->compute(componentPin);
-        }
+    size_t sweep = m_context ? m_context->getSweep() : 0;
+    if (!source.enter(sweep)) {
+        if (m_context)
+            m_context->cutOff();
+        return (Tristate::Undefined);
     }
+
+    size_t before = m_context ? m_context->getCutoffs() : 0;
+    Tristate result = component->compute(otherPin);
+    source.leave();
+
+    // A value cut short by the cycle guard depends on where the read
+    // started from, so only complete computations are remembered
+    if (m_context && m_context->getCutoffs() == before)
+        source.memoize(result, sweep);
+    return (result);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-Tristate AComponent::getInputState(size_t pin)
+Tristate64 AComponent::getInputState64(size_t pin)
 {
-    static thread_local std::set<
-        std::pair<const IComponent*, size_t>
-    > computingPins;
-
     if (m_pins[pin].getType() == Pin::Type::ELECTRICAL)
-        return (Tristate::Undefined);
+        return (Tristate64());
     if (pin >= m_pins.size() || m_pins[pin].getType() == Pin::Type::OUTPUT)
         throw ComponentException("Invalid input pin");
-    Tristate result = Tristate::Undefined;
-    for (const auto& link : m_pins[pin].getLinks()) {
-        if (auto component = link.component.lock()) {
-            auto pinPair = std::make_pair(component.get(), link.pin);
-            if (computingPins.find(pinPair) != computingPins.end()) {
-                return (Tristate::Undefined);
-            }
 
-            computingPins.insert(pinPair);
-            result = component->compute(link.pin);
-            computingPins.erase(pinPair);
+    auto [component, otherPin] = getDriver(pin);
+    if (!component)
+        return (Tristate64());
 
-            break;
-        }
+    Pin& source = component->getPins()[otherPin];
+    if (m_context && source.isPatternMemoized(m_context->getSweep()))
+        return (source.getPattern());
+
+    size_t sweep = m_context ? m_context->getSweep() : 0;
+    if (!source.enter(sweep)) {
+        if (m_context)
+            m_context->cutOff();
+        return (Tristate64());
     }
+
+    size_t before = m_context ? m_context->getCutoffs() : 0;
+    Tristate64 result = component->compute64(otherPin);
+    source.leave();
+
+    if (m_context && m_context->getCutoffs() == before)
+        source.memoizePattern(result, sweep);
     return (result);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-std::vector<Pin>& AComponent::getPins(void)
+std::pair<IComponent*, size_t> AComponent::getDriver(size_t pin) const
+{
+    if (m_context && m_index < m_context->getNets().size()) {
+        const Engines::NetTable& nets = m_context->getNets();
+        const Engines::NetTable::Endpoint& driver =
+            nets.getDriver(m_index, pin);
+        if (driver.component == Engines::NetTable::NONE)
+            return (std::make_pair(nullptr, 0));
+        return (std::make_pair(
+            nets.getComponent(driver.component),
+            static_cast<size_t>(driver.pin)
+        ));
+    }
+    if (m_owner) {
+        if (m_ownerPins[pin] == Engines::NetTable::NONE)
+            return (std::make_pair(nullptr, 0));
+        return (std::make_pair(m_owner, m_ownerPins[pin]));
+    }
+    for (const auto& link : m_pins[pin].getLinks()) {
+        if (auto other = link.component.lock())
+            return (std::make_pair(other.get(), link.pin));
+    }
+    return (std::make_pair(nullptr, 0));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::pmr::vector<Pin>& AComponent::getPins(void)
 {
     return (m_pins);
 }
@@ -209,7 +344,7 @@ void AComponent::draw(void)
     }
 
     std::string cls = getCleanClassName();
-    std::string name = m_name + " (" + cls + ")";
+    std::string name = getName() + " (" + cls + ")";
 
     applyColors(cls);
 
@@ -8,7 +8,10 @@
 ///////////////////////////////////////////////////////////////////////////////
 #include "IComponent.hpp"
 #include "Pin.hpp"
+#include "Engines/Context.hpp"
 #include <string>
+#include <type_traits>
+#include <utility>
 #include <vector>
 #include <stdexcept>
 #include <iostream>
@@ -31,9 +34,14 @@ protected:
     ///////////////////////////////////////////////////////////////////////////
     // Protected properties
     ///////////////////////////////////////////////////////////////////////////
-    std::string m_name;                         //<!
-    std::vector<Pin> m_pins;                    //<!
+    std::pmr::string m_name;                    //<! In the circuit arena
+    std::pmr::vector<Pin> m_pins;               //<! In the circuit arena
     size_t m_tick;                              //<!
+    Engines::Context* m_context;                //<!
+    uint32_t m_index;                           //<! Net table index
+    bool m_changed;                             //<! By the last simulate
+    IComponent* m_owner;                        //<! Of a part, else null
+    std::pmr::vector<uint32_t> m_ownerPins;     //<! Owner pin driving a pin
 #ifdef NTS_BONUS
     bool m_pinsInitialized = false;             //<!
     std::vector<std::string> m_pinLabels;       //<!
@@ -69,6 +77,19 @@ public:
         size_t otherPin
     ) override;
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Drive an input of a part from a pin of the component owning it
+    ///
+    /// A part lives inside its owner, so its reads reach the owner through a
+    /// plain pointer, set once, instead of locking a Link every time.
+    ///
+    /// \param pin
+    /// \param owner
+    /// \param ownerPin
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void setOwner(size_t pin, IComponent& owner, size_t ownerPin);
+
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
     ///
@@ -77,6 +98,80 @@ public:
     ///////////////////////////////////////////////////////////////////////////
     virtual void simulate(size_t tick) override;
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Components without a bit-parallel model throw
+    ///
+    /// \param pin
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    virtual Tristate64 compute64(size_t pin) override;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param epoch
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    virtual void evaluate(size_t epoch) override;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param epoch
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    virtual void settle(size_t epoch) override;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param context
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    virtual void setContext(Engines::Context* context) override;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param index
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    virtual void setIndex(uint32_t index) override;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    virtual bool hasSideEffects(void) const override;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    virtual bool hasChanged(void) const override;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Save the pin states and the last simulated tick
+    ///
+    /// \param snapshot
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    virtual void saveState(Snapshot& snapshot) const override;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param snapshot
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    virtual void loadState(Snapshot& snapshot) override;
+
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
     ///
@@ -91,7 +186,7 @@ public:
     /// \return
     ///
     ///////////////////////////////////////////////////////////////////////////
-    virtual std::vector<Pin>& getPins(void) override;
+    virtual std::pmr::vector<Pin>& getPins(void) override;
 
 #ifdef NTS_BONUS
 private:
@@ -153,6 +248,44 @@ protected:
     ///
     ///////////////////////////////////////////////////////////////////////////
     Tristate getInputState(size_t pin);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param pin
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Tristate64 getInputState64(size_t pin);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Write a piece of the state, flagging the component as changed
+    /// if the value differs
+    ///
+    /// \param slot
+    /// \param value
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    void store(T& slot, const std::type_identity_t<T>& value)
+    {
+        if (slot == value)
+            return;
+        slot = value;
+        m_changed = true;
+    }
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Find the pin driving one of our input pins
+    ///
+    /// \param pin
+    ///
+    /// \return The driving component and pin, nullptr if unlinked
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    std::pair<IComponent*, size_t> getDriver(size_t pin) const;
 };
 
 } // namespace nts
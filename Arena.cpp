@@ -0,0 +1,72 @@
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Arena.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace nts
+///////////////////////////////////////////////////////////////////////////////
+namespace nts
+{
+
+///////////////////////////////////////////////////////////////////////////////
+// Size of the first block, later ones grow geometrically
+///////////////////////////////////////////////////////////////////////////////
+static constexpr size_t INITIAL_BLOCK = 64 * 1024;
+
+///////////////////////////////////////////////////////////////////////////////
+static thread_local std::pmr::memory_resource* CurrentResource = nullptr;
+
+///////////////////////////////////////////////////////////////////////////////
+Arena::Scope::Scope(Arena& arena)
+    : m_previous(CurrentResource)
+{
+    CurrentResource = &arena;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Arena::Scope::~Scope()
+{
+    CurrentResource = m_previous;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Arena::Arena(void)
+    : m_buffer(INITIAL_BLOCK)
+{}
+
+///////////////////////////////////////////////////////////////////////////////
+std::pmr::memory_resource* Arena::getCurrent(void)
+{
+    if (CurrentResource)
+        return (CurrentResource);
+    return (std::pmr::get_default_resource());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Arena::release(void)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_buffer.release();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void* Arena::do_allocate(size_t bytes, size_t alignment)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    return (m_buffer.allocate(bytes, alignment));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Arena::do_deallocate(void*, size_t, size_t)
+{}
+
+///////////////////////////////////////////////////////////////////////////////
+bool Arena::do_is_equal(const std::pmr::memory_resource& other) const noexcept
+{
+    return (this == &other);
+}
+
+} // namespace nts
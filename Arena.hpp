@@ -0,0 +1,128 @@
+///////////////////////////////////////////////////////////////////////////////
+// Header guard
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include <cstddef>
+#include <memory_resource>
+#include <mutex>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace nts
+///////////////////////////////////////////////////////////////////////////////
+namespace nts
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Monotonic memory for the components of one circuit
+///
+/// Components, their names, their pin arrays, the pin names and the link
+/// arrays are carved one after the other from large blocks, and the blocks
+/// are only handed back when the whole circuit goes away.
+///
+/// Objects built while a Scope is alive on the current thread allocate from
+/// that arena. Outside of any scope, getCurrent() is the default resource.
+/// Containers keep the resource they were built with, so growing them later
+/// still draws from the owning circuit's arena whatever the calling thread;
+/// allocation is locked for that reason.
+///
+///////////////////////////////////////////////////////////////////////////////
+class Arena : public std::pmr::memory_resource
+{
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Make an arena current on this thread until destroyed
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    class Scope
+    {
+    private:
+        ///////////////////////////////////////////////////////////////////////
+        // Private properties
+        ///////////////////////////////////////////////////////////////////////
+        std::pmr::memory_resource* m_previous;  //<!
+
+    public:
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief
+        ///
+        /// \param arena
+        ///
+        ///////////////////////////////////////////////////////////////////////
+        explicit Scope(Arena& arena);
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief
+        ///
+        ///////////////////////////////////////////////////////////////////////
+        ~Scope();
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+    };
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    // Private properties
+    ///////////////////////////////////////////////////////////////////////////
+    std::pmr::monotonic_buffer_resource m_buffer;   //<!
+    std::mutex m_mutex;                             //<!
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Arena(void);
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the resource objects built on this thread should use
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static std::pmr::memory_resource* getCurrent(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Free every block at once
+    ///
+    /// Nothing allocated from the arena may be alive anymore.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void release(void);
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param bytes
+    /// \param alignment
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void* do_allocate(size_t bytes, size_t alignment) override;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Nothing is freed before release()
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void do_deallocate(void*, size_t, size_t) override;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param other
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    bool do_is_equal(const std::pmr::memory_resource& other)
+        const noexcept override;
+};
+
+} // namespace nts
@@ -3,6 +3,7 @@
 ///////////////////////////////////////////////////////////////////////////////
 #include "C4013.hpp"
 #include "Errors/OutOfRangePinException.hpp"
+#include "Snapshot.hpp"
 
 ///////////////////////////////////////////////////////////////////////////////
 // Namespace nts::Components
@@ -17,7 +18,6 @@ C4013::C4013(const std::string& name)
         Sequencials::FlipFlop(name + "_1"),
         Sequencials::FlipFlop(name + "_2")
     }
-    , m_initialized(false)
 {
     m_pins[2] = Pin(Pin::Type::INPUT);
     m_pins[3] = Pin(Pin::Type::INPUT);
@@ -35,32 +35,27 @@ C4013::C4013(const std::string& name)
 
     m_pins[6] = Pin(Pin::Type::ELECTRICAL);
     m_pins[13] = Pin(Pin::Type::ELECTRICAL);
+
+    initializeLinks();
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 void C4013::initializeLinks(void)
 {
-    if (m_initialized)
-        return;
-    m_flipflops[0].setLink(0, shared_from_this(), 2);
-    m_flipflops[0].setLink(1, shared_from_this(), 4);
-    m_flipflops[0].setLink(2, shared_from_this(), 5);
-    m_flipflops[0].setLink(3, shared_from_this(), 3);
+    m_flipflops[0].setOwner(0, *this, 2);
+    m_flipflops[0].setOwner(1, *this, 4);
+    m_flipflops[0].setOwner(2, *this, 5);
+    m_flipflops[0].setOwner(3, *this, 3);
 
-    m_flipflops[1].setLink(0, shared_from_this(), 10);
-    m_flipflops[1].setLink(1, shared_from_this(), 8);
-    m_flipflops[1].setLink(2, shared_from_this(), 7);
-    m_flipflops[1].setLink(3, shared_from_this(), 9);
-
-    m_initialized = true;
+    m_flipflops[1].setOwner(0, *this, 10);
+    m_flipflops[1].setOwner(1, *this, 8);
+    m_flipflops[1].setOwner(2, *this, 7);
+    m_flipflops[1].setOwner(3, *this, 9);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 Tristate C4013::compute(size_t pin)
 {
-    if (!m_initialized)
-        initializeLinks();
-
     switch (pin) {
         case 6:
         case 13:
@@ -96,11 +91,36 @@ void C4013::simulate(size_t tick)
 
     m_flipflops[0].simulate(tick);
     m_flipflops[1].simulate(tick);
+    m_changed = m_flipflops[0].hasChanged() || m_flipflops[1].hasChanged();
 
+    propagateOutput(0, compute(0));
     propagateOutput(1, compute(1));
-    propagateOutput(2, compute(2));
-    propagateOutput(13, compute(13));
+    propagateOutput(11, compute(11));
     propagateOutput(12, compute(12));
 }
 
+///////////////////////////////////////////////////////////////////////////////
+Sequencials::FlipFlop& C4013::getFlipFlop(size_t half)
+{
+    if (half >= m_flipflops.size())
+        throw OutOfRangePinException();
+    return (m_flipflops[half]);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void C4013::saveState(Snapshot& snapshot) const
+{
+    AComponent::saveState(snapshot);
+    for (const auto& flipflop : m_flipflops)
+        flipflop.saveState(snapshot);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void C4013::loadState(Snapshot& snapshot)
+{
+    AComponent::loadState(snapshot);
+    for (auto& flipflop : m_flipflops)
+        flipflop.loadState(snapshot);
+}
+
 } // namespace nts::Components
@@ -27,7 +27,6 @@ private:
     //
     ///////////////////////////////////////////////////////////////////////////
     std::array<Sequencials::FlipFlop, 2> m_flipflops;
-    bool m_initialized;
 
 public:
     ///////////////////////////////////////////////////////////////////////////
@@ -40,7 +39,7 @@ public:
 
 private:
     ///////////////////////////////////////////////////////////////////////////
-    /// \brief
+    /// \brief Drive the inputs of every part from our pins
     ///
     ///////////////////////////////////////////////////////////////////////////
     void initializeLinks(void);
@@ -65,6 +64,32 @@ public:
     ///
     ///////////////////////////////////////////////////////////////////////////
     Tristate compute(size_t pin) override;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Latch of one half of the package
+    ///
+    /// \param half 0 for pins 1 to 6, 1 for pins 8 to 13
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Sequencials::FlipFlop& getFlipFlop(size_t half);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param snapshot
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void saveState(Snapshot& snapshot) const override;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param snapshot
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void loadState(Snapshot& snapshot) override;
 };
 
 } // namespace nts::Components
@@ -3,6 +3,7 @@
 ///////////////////////////////////////////////////////////////////////////////
 #include "C4017.hpp"
 #include "Errors/OutOfRangePinException.hpp"
+#include "Snapshot.hpp"
 
 ///////////////////////////////////////////////////////////////////////////////
 // Namespace nts::Components
@@ -99,20 +100,38 @@ void C4017::simulate(size_t tick)
     Tristate mr = getInputState(14);
 
     if (cp0 == Tristate::True && cp1 == Tristate::False && m_lastCp0 != Tristate::True) {
-        m_count += m_count < 9 ? 1 : -9;
+        store(m_count, m_count < 9 ? m_count + 1 : m_count - 9);
     }
     if (cp0 == Tristate::True && cp1 == Tristate::False && m_lastCp1 != Tristate::False) {
-        m_count += m_count < 9 ? 1 : -9;
+        store(m_count, m_count < 9 ? m_count + 1 : m_count - 9);
     }
     if (mr == Tristate::True) {
-        m_count = 0;
+        store(m_count, 0);
     }
-    m_lastCp0 = cp0;
-    m_lastCp1 = cp1;
+    store(m_lastCp0, cp0);
+    store(m_lastCp1, cp1);
 
     for (size_t pin : {0, 1, 2, 3, 4, 5, 6, 8, 9, 10, 11}) {
         propagateOutput(pin, compute(pin));
     }
 }
 
+///////////////////////////////////////////////////////////////////////////////
+void C4017::saveState(Snapshot& snapshot) const
+{
+    AComponent::saveState(snapshot);
+    snapshot.write(m_count);
+    snapshot.write(m_lastCp0);
+    snapshot.write(m_lastCp1);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void C4017::loadState(Snapshot& snapshot)
+{
+    AComponent::loadState(snapshot);
+    m_count = snapshot.read<size_t>();
+    m_lastCp0 = snapshot.read<Tristate>();
+    m_lastCp1 = snapshot.read<Tristate>();
+}
+
 } // namespace nts::Components
\ No newline at end of file
@@ -66,6 +66,22 @@ public:
     ///
     ///////////////////////////////////////////////////////////////////////////
     Tristate compute(size_t pin) override;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param snapshot
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void saveState(Snapshot& snapshot) const override;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param snapshot
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void loadState(Snapshot& snapshot) override;
 };
 
 } // namespace nts::Components
\ No newline at end of file
@@ -3,6 +3,7 @@
 ///////////////////////////////////////////////////////////////////////////////
 #include "C4040.hpp"
 #include "Errors/OutOfRangePinException.hpp"
+#include "Snapshot.hpp"
 
 ///////////////////////////////////////////////////////////////////////////////
 // Namespace nts::Components
@@ -73,19 +74,37 @@ void C4040::simulate(size_t tick)
         return;
     AComponent::simulate(tick);
 
-    Tristate clock = getInputState(9);
-    Tristate reset = getInputState(10);
+    count(getInputState(9), getInputState(10));
+}
 
+///////////////////////////////////////////////////////////////////////////////
+void C4040::count(Tristate clock, Tristate reset)
+{
     if (reset == Tristate::True) {
-        m_count = 0;
+        store(m_count, 0);
     } else {
         if (m_lastClock == Tristate::True && clock == Tristate::False) {
-            m_count++;
+            store(m_count, (m_count + 1) & 0xFFF);  // 12 stages
         }
     }
 
-    m_lastClock = clock;
+    store(m_lastClock, clock);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void C4040::saveState(Snapshot& snapshot) const
+{
+    AComponent::saveState(snapshot);
+    snapshot.write(m_count);
+    snapshot.write(m_lastClock);
+}
 
+///////////////////////////////////////////////////////////////////////////////
+void C4040::loadState(Snapshot& snapshot)
+{
+    AComponent::loadState(snapshot);
+    m_count = snapshot.read<int>();
+    m_lastClock = snapshot.read<Tristate>();
 }
 
 } // namespace nts::Components
\ No newline at end of file
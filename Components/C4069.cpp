@@ -3,6 +3,7 @@
 ///////////////////////////////////////////////////////////////////////////////
 #include "C4069.hpp"
 #include "Errors/OutOfRangePinException.hpp"
+#include "Snapshot.hpp"
 
 ///////////////////////////////////////////////////////////////////////////////
 // Namespace nts::Components
@@ -42,6 +43,13 @@ C4069::C4069(const std::string& name)
 
     m_pins[6] = Pin(Pin::Type::ELECTRICAL);
     m_pins[13] = Pin(Pin::Type::ELECTRICAL);
+
+    m_gates[0].setOwner(0, *this, 0);
+    m_gates[1].setOwner(0, *this, 2);
+    m_gates[2].setOwner(0, *this, 4);
+    m_gates[3].setOwner(0, *this, 8);
+    m_gates[4].setOwner(0, *this, 10);
+    m_gates[5].setOwner(0, *this, 12);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -71,6 +79,33 @@ Tristate C4069::compute(size_t pin)
     }
 }
 
+///////////////////////////////////////////////////////////////////////////////
+Tristate64 C4069::compute64(size_t pin)
+{
+    switch (pin) {
+        case 6:
+        case 13:
+            return (Tristate64());
+        case 0:
+        case 2:
+        case 4:
+        case 8:
+        case 10:
+        case 12:
+            return (getInputState64(pin));
+        case 1:
+        case 3:
+        case 5:
+            return (~(getInputState64(pin - 1)));
+        case 7:
+        case 9:
+        case 11:
+            return (~(getInputState64(pin + 1)));
+        default:
+            throw OutOfRangePinException();
+    }
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 void C4069::simulate(size_t tick)
 {
@@ -85,4 +120,20 @@ void C4069::simulate(size_t tick)
     propagateOutput(11, compute(11));
 }
 
+///////////////////////////////////////////////////////////////////////////////
+void C4069::saveState(Snapshot& snapshot) const
+{
+    AComponent::saveState(snapshot);
+    for (const auto& gate : m_gates)
+        gate.saveState(snapshot);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void C4069::loadState(Snapshot& snapshot)
+{
+    AComponent::loadState(snapshot);
+    for (auto& gate : m_gates)
+        gate.loadState(snapshot);
+}
+
 } // namespace nts::Components
@@ -57,6 +57,32 @@ public:
     ///
     ///////////////////////////////////////////////////////////////////////////
     Tristate compute(size_t pin) override;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param pin
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Tristate64 compute64(size_t pin) override;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param snapshot
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void saveState(Snapshot& snapshot) const override;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param snapshot
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void loadState(Snapshot& snapshot) override;
 };
 
 } // namespace nts::Components
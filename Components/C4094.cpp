@@ -3,6 +3,7 @@
 ///////////////////////////////////////////////////////////////////////////////
 #include "C4094.hpp"
 #include "Errors/OutOfRangePinException.hpp"
+#include "Snapshot.hpp"
 
 ///////////////////////////////////////////////////////////////////////////////
 // Namespace nts::Components
@@ -100,32 +101,57 @@ void C4094::simulate(size_t tick)
         // Don't update shift register with undefined inputs
     } else {
         if (m_lastClock == Tristate::False && clock == Tristate::True) {
-            m_previousSerialOut = m_serialOut;
+            store(m_previousSerialOut, m_serialOut);
 
-            m_serialOut = ((m_shiftRegister >> 7) & 0x01) ? True : False;
+            store(m_serialOut, ((m_shiftRegister >> 7) & 0x01) ? True : False);
 
-            m_shiftRegister = ((m_shiftRegister << 1) & 0xFE);
+            uint8_t shifted = ((m_shiftRegister << 1) & 0xFE);
             if (data == Tristate::True) {
-                m_shiftRegister |= 0x01;
+                shifted |= 0x01;
             }
+            store(m_shiftRegister, shifted);
         }
         else if (m_lastClock == Tristate::True && clock == Tristate::False) {
-            m_previousSerialOut = m_serialOut;
+            store(m_previousSerialOut, m_serialOut);
         }
     }
 
     if (strobe != Tristate::Undefined) {
         if (m_lastStrobe == Tristate::True && strobe == Tristate::False) {
-            m_storageRegister = m_shiftRegister;
+            store(m_storageRegister, m_shiftRegister);
         }
     }
 
-    m_lastClock = clock;
-    m_lastStrobe = strobe;
+    store(m_lastClock, clock);
+    store(m_lastStrobe, strobe);
 
     for (size_t pin : {3, 4, 5, 6, 8, 9, 10, 11, 12, 13}) {
         propagateOutput(pin, compute(pin));
     }
 }
 
+///////////////////////////////////////////////////////////////////////////////
+void C4094::saveState(Snapshot& snapshot) const
+{
+    AComponent::saveState(snapshot);
+    snapshot.write(m_lastClock);
+    snapshot.write(m_shiftRegister);
+    snapshot.write(m_storageRegister);
+    snapshot.write(m_lastStrobe);
+    snapshot.write(m_serialOut);
+    snapshot.write(m_previousSerialOut);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void C4094::loadState(Snapshot& snapshot)
+{
+    AComponent::loadState(snapshot);
+    m_lastClock = snapshot.read<Tristate>();
+    m_shiftRegister = snapshot.read<uint8_t>();
+    m_storageRegister = snapshot.read<uint8_t>();
+    m_lastStrobe = snapshot.read<Tristate>();
+    m_serialOut = snapshot.read<Tristate>();
+    m_previousSerialOut = snapshot.read<Tristate>();
+}
+
 } // namespace nts::Components
\ No newline at end of file
@@ -3,6 +3,7 @@
 ///////////////////////////////////////////////////////////////////////////////
 #include "C4514.hpp"
 #include "Errors/OutOfRangePinException.hpp"
+#include "Snapshot.hpp"
 ///////////////////////////////////////////////////////////////////////////////
 // Namespace nts::Components
 ///////////////////////////////////////////////////////////////////////////////
@@ -99,23 +100,24 @@ void C4514::simulate(size_t tick)
     Tristate currentStrobe = getInputState(0);
 
     if (currentStrobe == Tristate::Undefined) {
-        m_previousStrobe = false;
+        store(m_previousStrobe, false);
     } else if (m_previousStrobe && currentStrobe == Tristate::False) {
         if (getInputState(1) == Tristate::Undefined ||
             getInputState(2) == Tristate::Undefined ||
             getInputState(20) == Tristate::Undefined ||
             getInputState(21) == Tristate::Undefined) {
         } else {
-            m_latchedAddress = 0;
-            if (getInputState(1) == Tristate::True)  m_latchedAddress |= 1; // A
-            if (getInputState(2) == Tristate::True)  m_latchedAddress |= 2; // B
-            if (getInputState(20) == Tristate::True) m_latchedAddress |= 4; // C
-            if (getInputState(21) == Tristate::True) m_latchedAddress |= 8; // D
+            unsigned int address = 0;
+            if (getInputState(1) == Tristate::True)  address |= 1; // A
+            if (getInputState(2) == Tristate::True)  address |= 2; // B
+            if (getInputState(20) == Tristate::True) address |= 4; // C
+            if (getInputState(21) == Tristate::True) address |= 8; // D
+            store(m_latchedAddress, address);
         }
     }
 
     if (currentStrobe != Tristate::Undefined) {
-        m_previousStrobe = (currentStrobe == Tristate::True);
+        store(m_previousStrobe, currentStrobe == Tristate::True);
     }
 
     // Propagate outputs
@@ -125,4 +127,20 @@ void C4514::simulate(size_t tick)
     }
 }
 
+///////////////////////////////////////////////////////////////////////////////
+void C4514::saveState(Snapshot& snapshot) const
+{
+    AComponent::saveState(snapshot);
+    snapshot.write(m_latchedAddress);
+    snapshot.write(m_previousStrobe);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void C4514::loadState(Snapshot& snapshot)
+{
+    AComponent::loadState(snapshot);
+    m_latchedAddress = snapshot.read<unsigned int>();
+    m_previousStrobe = snapshot.read<bool>();
+}
+
 } // namespace nts::Components
\ No newline at end of file
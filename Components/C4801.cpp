@@ -3,6 +3,7 @@
 ///////////////////////////////////////////////////////////////////////////////
 #include "C4801.hpp"
 #include "Errors/OutOfRangePinException.hpp"
+#include "Snapshot.hpp"
 
 ///////////////////////////////////////////////////////////////////////////////
 // Namespace nts::Components
@@ -102,7 +103,7 @@ void C4801::writeToMemory(void)
         if (getInputState(15) == Tristate::True) value |= 0x40;
         if (getInputState(16) == Tristate::True) value |= 0x80;
 
-        m_memory[address] = static_cast<Tristate>(value);
+        store(m_memory[address], static_cast<Tristate>(value));
     }
 }
 
@@ -206,4 +207,20 @@ Tristate C4801::compute(size_t pin) {
     return (Tristate::Undefined);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+void C4801::saveState(Snapshot& snapshot) const
+{
+    AComponent::saveState(snapshot);
+    for (Tristate value : m_memory)
+        snapshot.write(value);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void C4801::loadState(Snapshot& snapshot)
+{
+    AComponent::loadState(snapshot);
+    for (Tristate& value : m_memory)
+        value = snapshot.read<Tristate>();
+}
+
 } // namespace nts::Components
@@ -3,6 +3,7 @@
 ///////////////////////////////////////////////////////////////////////////////
 #include "QuadGate.hpp"
 #include "Errors/OutOfRangePinException.hpp"
+#include "Snapshot.hpp"
 
 ///////////////////////////////////////////////////////////////////////////////
 // Namespace nts::Components
@@ -20,7 +21,6 @@ QuadGate<GateType>::QuadGate(const std::string& name)
         GateType(name + "_3"),
         GateType(name + "_4"),
     }
-    , m_initialized(false)
 {
     m_pins[0] = Pin(Pin::Type::INPUT);
     m_pins[1] = Pin(Pin::Type::INPUT);
@@ -40,35 +40,28 @@ QuadGate<GateType>::QuadGate(const std::string& name)
 
     m_pins[6] = Pin(Pin::Type::ELECTRICAL);
     m_pins[13] = Pin(Pin::Type::ELECTRICAL);
+
+    initializeLinks();
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 template <typename GateType>
 void QuadGate<GateType>::initializeLinks(void)
 {
-    if (m_initialized)
-        return;
-    auto self = shared_from_this();
-
-    m_gates[0].setLink(0, self, 0);
-    m_gates[0].setLink(1, self, 1);
-    m_gates[1].setLink(0, self, 4);
-    m_gates[1].setLink(1, self, 5);
-    m_gates[2].setLink(0, self, 7);
-    m_gates[2].setLink(1, self, 8);
-    m_gates[3].setLink(0, self, 11);
-    m_gates[3].setLink(1, self, 12);
-
-    m_initialized = true;
+    m_gates[0].setOwner(0, *this, 0);
+    m_gates[0].setOwner(1, *this, 1);
+    m_gates[1].setOwner(0, *this, 4);
+    m_gates[1].setOwner(1, *this, 5);
+    m_gates[2].setOwner(0, *this, 7);
+    m_gates[2].setOwner(1, *this, 8);
+    m_gates[3].setOwner(0, *this, 11);
+    m_gates[3].setOwner(1, *this, 12);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 template <typename GateType>
 Tristate QuadGate<GateType>::compute(size_t pin)
 {
-    if (!m_initialized)
-        initializeLinks();
-
     switch (pin) {
         case 0:
         case 1:
@@ -95,6 +88,36 @@ Tristate QuadGate<GateType>::compute(size_t pin)
     }
 }
 
+///////////////////////////////////////////////////////////////////////////////
+template <typename GateType>
+Tristate64 QuadGate<GateType>::compute64(size_t pin)
+{
+    switch (pin) {
+        case 0:
+        case 1:
+        case 4:
+        case 5:
+        case 7:
+        case 8:
+        case 11:
+        case 12:
+            return (getInputState64(pin));
+        case 6:
+        case 13:
+            return (Tristate64());
+        case 2:
+            return (m_gates[0].compute64(2));
+        case 3:
+            return (m_gates[1].compute64(2));
+        case 9:
+            return (m_gates[2].compute64(2));
+        case 10:
+            return (m_gates[3].compute64(2));
+        default:
+            throw OutOfRangePinException();
+    }
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 template <typename GateType>
 void QuadGate<GateType>::simulate(size_t tick)
@@ -108,4 +131,22 @@ void QuadGate<GateType>::simulate(size_t tick)
     propagateOutput(10, compute(10));
 }
 
+///////////////////////////////////////////////////////////////////////////////
+template <typename GateType>
+void QuadGate<GateType>::saveState(Snapshot& snapshot) const
+{
+    AComponent::saveState(snapshot);
+    for (const auto& gate : m_gates)
+        gate.saveState(snapshot);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename GateType>
+void QuadGate<GateType>::loadState(Snapshot& snapshot)
+{
+    AComponent::loadState(snapshot);
+    for (auto& gate : m_gates)
+        gate.loadState(snapshot);
+}
+
 } // namespace nts::Components
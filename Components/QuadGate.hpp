@@ -34,7 +34,6 @@ private:
     //
     ///////////////////////////////////////////////////////////////////////////
     std::array<GateType, 4> m_gates;
-    bool m_initialized;
 
 public:
     ///////////////////////////////////////////////////////////////////////////
@@ -47,7 +46,7 @@ public:
 
 private:
     ///////////////////////////////////////////////////////////////////////////
-    /// \brief
+    /// \brief Drive the inputs of every part from our pins
     ///
     ///////////////////////////////////////////////////////////////////////////
     void initializeLinks(void);
@@ -72,6 +71,32 @@ public:
     ///
     ///////////////////////////////////////////////////////////////////////////
     Tristate compute(size_t pin) override;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param pin
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Tristate64 compute64(size_t pin) override;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param snapshot
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void saveState(Snapshot& snapshot) const override;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param snapshot
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void loadState(Snapshot& snapshot) override;
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3,6 +3,7 @@
 ///////////////////////////////////////////////////////////////////////////////
 #include "logger.hpp"
 #include "Errors/OutOfRangePinException.hpp"
+#include "Snapshot.hpp"
 #include <fstream>
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -66,4 +67,24 @@ void logger::simulate(size_t tick)
     m_lastClock = clock;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+bool logger::hasSideEffects(void) const
+{
+    return (true);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void logger::saveState(Snapshot& snapshot) const
+{
+    AComponent::saveState(snapshot);
+    snapshot.write(m_lastClock);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void logger::loadState(Snapshot& snapshot)
+{
+    AComponent::loadState(snapshot);
+    m_lastClock = snapshot.read<Tristate>();
+}
+
 } // namespace nts::Components
@@ -0,0 +1,384 @@
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Engines/Bytecode.hpp"
+#include "Components/C4008.hpp"
+#include "Components/C4013.hpp"
+#include "Components/C4040.hpp"
+#include "Components/C4069.hpp"
+#include "Components/QuadGate.hpp"
+#include "Gates/And.hpp"
+#include "Gates/Nand.hpp"
+#include "Gates/Nor.hpp"
+#include "Gates/Not.hpp"
+#include "Gates/Or.hpp"
+#include "Gates/Xor.hpp"
+#include "Sequencials/Counter.hpp"
+#include "Sequencials/FlipFlop.hpp"
+#include "Specials/Output.hpp"
+#include <stdexcept>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace nts::Engines
+///////////////////////////////////////////////////////////////////////////////
+namespace nts::Engines
+{
+
+///////////////////////////////////////////////////////////////////////////////
+// Output pin of each gate of a quad package, followed by its two inputs
+///////////////////////////////////////////////////////////////////////////////
+static constexpr size_t QUAD_GATES[4][3] = {
+    {2, 0, 1}, {3, 4, 5}, {9, 7, 8}, {10, 11, 12}
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// Output pin of each inverter of a 4069, followed by its input
+///////////////////////////////////////////////////////////////////////////////
+static constexpr size_t HEX_INVERTERS[6][2] = {
+    {1, 0}, {3, 2}, {5, 4}, {7, 8}, {9, 10}, {11, 12}
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// Counter outputs of a 4040
+///////////////////////////////////////////////////////////////////////////////
+static constexpr size_t RIPPLE_OUTPUTS[] = {
+    0, 1, 2, 3, 4, 5, 6, 8, 11, 12, 13, 14
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// Lookup tables of a full adder stage, as `C4008::fullAdder` computes it
+///////////////////////////////////////////////////////////////////////////////
+static constexpr uint32_t SUM_TABLE = 0;
+static constexpr uint32_t CARRY_TABLE = 1;
+static constexpr Tristate TRISTATES[] = {
+    Tristate::Undefined, Tristate::False, Tristate::True
+};
+
+///////////////////////////////////////////////////////////////////////////////
+static size_t lookup(Tristate a, Tristate b, Tristate c)
+{
+    return ((a + 1) + 3 * (b + 1) + 9 * (c + 1));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Bytecode::compile(const ComponentMap&, Context& context)
+{
+    const NetTable& nets = context.getNets();
+
+    m_context = &context;
+    m_netlist.build(nets);
+    m_code.clear();
+    m_flipflops.clear();
+    m_counters.clear();
+    m_ripples.clear();
+    m_natives.clear();
+
+    m_tables.assign(2, {});
+    for (Tristate a : TRISTATES) {
+        for (Tristate b : TRISTATES) {
+            for (Tristate c : TRISTATES) {
+                bool known = a != Tristate::Undefined &&
+                    b != Tristate::Undefined && c != Tristate::Undefined;
+                m_tables[SUM_TABLE][lookup(a, b, c)] = known
+                    ? a ^ b ^ c : Tristate::Undefined;
+                m_tables[CARRY_TABLE][lookup(a, b, c)] = known
+                    ? (a & b) | (c & (a ^ b)) : Tristate::Undefined;
+            }
+        }
+    }
+
+    m_values.assign(1, Tristate::Undefined);
+    m_latches.assign(1, nullptr);
+    m_offsets.assign(1, 0);
+    m_slots.clear();
+    for (IComponent* component : m_netlist.getComponents()) {
+        for (Pin& pin : component->getPins()) {
+            if (pin.getType() != Pin::Type::OUTPUT) {
+                m_slots.push_back(0);
+                continue;
+            }
+            m_slots.push_back(m_values.size());
+            m_values.push_back(Tristate::Undefined);
+            m_latches.push_back(&pin);
+        }
+        m_offsets.push_back(m_slots.size());
+    }
+
+    for (size_t index : m_netlist.getOrder())
+        lower(index);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Bytecode::simulate(size_t tick)
+{
+    size_t epoch = m_context->advance();
+    const uint32_t* code = m_code.data();
+    const uint32_t* end = code + m_code.size();
+    Tristate* values = m_values.data();
+
+    m_evaluations += m_netlist.getComponents().size();
+    while (code < end) {
+        switch (code[0]) {
+            case AND2:
+                store(code[3], values[code[1]] & values[code[2]], epoch);
+                code += 4;
+                break;
+            case OR2:
+                store(code[3], values[code[1]] | values[code[2]], epoch);
+                code += 4;
+                break;
+            case XOR2:
+                store(code[3], values[code[1]] ^ values[code[2]], epoch);
+                code += 4;
+                break;
+            case NAND2:
+                store(code[3], ~(values[code[1]] & values[code[2]]),
+                    epoch);
+                code += 4;
+                break;
+            case NOR2:
+                store(code[3], ~(values[code[1]] | values[code[2]]),
+                    epoch);
+                code += 4;
+                break;
+            case NOT:
+                store(code[2], ~values[code[1]], epoch);
+                code += 3;
+                break;
+            case LUT: {
+                const Table& table = m_tables[code[1]];
+                size_t entry = lookup(
+                    values[code[2]], values[code[3]], values[code[4]]);
+                store(code[5], table[entry], epoch);
+                code += 6;
+                break;
+            }
+            case LATCH: {
+                Sequencials::FlipFlop& flipflop = *m_flipflops[code[1]];
+                flipflop.latch(values[code[2]], values[code[3]],
+                    values[code[4]], values[code[5]]);
+                store(code[6], flipflop.compute(4), epoch);
+                store(code[7], flipflop.compute(5), epoch);
+                code += 8;
+                break;
+            }
+            case COUNTER: {
+                Sequencials::Counter& counter = *m_counters[code[1]];
+                counter.count(values[code[2]], values[code[3]]);
+                store(code[4], counter.compute(2), epoch);
+                store(code[5], counter.compute(3), epoch);
+                code += 6;
+                break;
+            }
+            case RIPPLE: {
+                Components::C4040& counter = *m_ripples[code[1]];
+                counter.count(values[code[2]], values[code[3]]);
+                for (uint32_t i = 0; i < code[4]; i++) {
+                    const uint32_t* output = code + 5 + 2 * i;
+                    store(output[1], counter.compute(output[0]), epoch);
+                }
+                code += 5 + 2 * code[4];
+                break;
+            }
+            case NATIVE: {
+                IComponent* component = m_natives[code[1]];
+                m_context->simulate(*component, tick);
+                component->evaluate(epoch);
+                auto& pins = component->getPins();
+                for (uint32_t i = 0; i < code[2]; i++) {
+                    const uint32_t* output = code + 3 + 2 * i;
+                    values[output[1]] = pins[output[0]].getState();
+                }
+                code += 3 + 2 * code[2];
+                break;
+            }
+            default:
+                throw std::logic_error("Invalid bytecode instruction");
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Bytecode::setThreads(size_t count)
+{
+    if (count > 1)
+        throw std::runtime_error("The bytecode engine is single-threaded");
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Bytecode::lower(size_t index)
+{
+    IComponent* component = m_netlist.getComponents()[index];
+    Opcode gate = NATIVE;
+
+    if (!m_netlist.isIsolated(index)) {
+        lowerNative(index);
+        return;
+    }
+    if (dynamic_cast<Specials::Output*>(component))
+        return;
+
+    if (dynamic_cast<Gates::And*>(component))       gate = AND2;
+    else if (dynamic_cast<Gates::Or*>(component))   gate = OR2;
+    else if (dynamic_cast<Gates::Xor*>(component))  gate = XOR2;
+    else if (dynamic_cast<Gates::Nand*>(component)) gate = NAND2;
+    else if (dynamic_cast<Gates::Nor*>(component))  gate = NOR2;
+    if (gate != NATIVE) {
+        m_code.insert(m_code.end(), {gate,
+            input(index, 0), input(index, 1), output(index, 2)});
+        return;
+    }
+    if (dynamic_cast<Gates::Not*>(component)) {
+        m_code.insert(m_code.end(), {NOT,
+            input(index, 0), output(index, 1)});
+        return;
+    }
+
+    if (dynamic_cast<Components::C4081*>(component))        gate = AND2;
+    else if (dynamic_cast<Components::C4071*>(component))   gate = OR2;
+    else if (dynamic_cast<Components::C4030*>(component))   gate = XOR2;
+    else if (dynamic_cast<Components::C4011*>(component))   gate = NAND2;
+    else if (dynamic_cast<Components::C4001*>(component))   gate = NOR2;
+    if (gate != NATIVE) {
+        for (const auto& [out, a, b] : QUAD_GATES)
+            m_code.insert(m_code.end(), {gate,
+                input(index, a), input(index, b), output(index, out)});
+        return;
+    }
+    if (dynamic_cast<Components::C4069*>(component)) {
+        for (const auto& [out, in] : HEX_INVERTERS)
+            m_code.insert(m_code.end(), {NOT,
+                input(index, in), output(index, out)});
+        return;
+    }
+    if (dynamic_cast<Components::C4008*>(component)) {
+        lowerAdder(index);
+        return;
+    }
+
+    if (auto flipflop = dynamic_cast<Sequencials::FlipFlop*>(component)) {
+        lowerLatch(*flipflop, index, {0, 1, 2, 3, 4, 5});
+        return;
+    }
+    if (auto dual = dynamic_cast<Components::C4013*>(component)) {
+        lowerLatch(dual->getFlipFlop(0), index, {2, 4, 5, 3, 1, 0});
+        lowerLatch(dual->getFlipFlop(1), index, {10, 8, 7, 9, 11, 12});
+        return;
+    }
+    if (auto counter = dynamic_cast<Sequencials::Counter*>(component)) {
+        m_code.insert(m_code.end(), {COUNTER,
+            static_cast<uint32_t>(m_counters.size()),
+            input(index, 0), input(index, 1),
+            output(index, 2), output(index, 3)});
+        m_counters.push_back(counter);
+        return;
+    }
+    if (auto counter = dynamic_cast<Components::C4040*>(component)) {
+        m_code.insert(m_code.end(), {RIPPLE,
+            static_cast<uint32_t>(m_ripples.size()),
+            input(index, 9), input(index, 10),
+            static_cast<uint32_t>(std::size(RIPPLE_OUTPUTS))});
+        for (size_t pin : RIPPLE_OUTPUTS)
+            m_code.insert(m_code.end(), {static_cast<uint32_t>(pin),
+                output(index, pin)});
+        m_ripples.push_back(counter);
+        return;
+    }
+
+    lowerNative(index);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Bytecode::lowerNative(size_t index)
+{
+    IComponent* component = m_netlist.getComponents()[index];
+    const auto& pins = component->getPins();
+    size_t count = m_code.size() + 2;
+
+    m_code.insert(m_code.end(), {NATIVE,
+        static_cast<uint32_t>(m_natives.size()), 0});
+    for (size_t pin = 0; pin < pins.size(); pin++) {
+        if (pins[pin].getType() != Pin::Type::OUTPUT)
+            continue;
+        m_code.insert(m_code.end(), {static_cast<uint32_t>(pin),
+            output(index, pin)});
+        m_code[count]++;
+    }
+    m_natives.push_back(component);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Bytecode::lowerAdder(size_t index)
+{
+    static constexpr size_t A[] = {6, 4, 2, 0};
+    static constexpr size_t B[] = {5, 3, 1, 14};
+    uint32_t carry = input(index, 8);
+
+    for (size_t bit = 0; bit < 4; bit++) {
+        uint32_t a = input(index, A[bit]);
+        uint32_t b = input(index, B[bit]);
+        uint32_t next = bit == 3 ? output(index, 13) : temporary();
+
+        m_code.insert(m_code.end(), {LUT, SUM_TABLE,
+            a, b, carry, output(index, 9 + bit)});
+        m_code.insert(m_code.end(), {LUT, CARRY_TABLE,
+            a, b, carry, next});
+        carry = next;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Bytecode::lowerLatch(
+    Sequencials::FlipFlop& flipflop,
+    size_t index,
+    const std::array<size_t, 6>& pins
+)
+{
+    m_code.insert(m_code.end(), {LATCH,
+        static_cast<uint32_t>(m_flipflops.size()),
+        input(index, pins[0]), input(index, pins[1]),
+        input(index, pins[2]), input(index, pins[3]),
+        output(index, pins[4]), output(index, pins[5])});
+    m_flipflops.push_back(&flipflop);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+uint32_t Bytecode::input(size_t index, size_t pin) const
+{
+    const NetTable::Endpoint& driver =
+        m_context->getNets().getDriver(index, pin);
+
+    if (driver.component == NetTable::NONE)
+        return (0);
+    return (m_slots[m_offsets[driver.component] + driver.pin]);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+uint32_t Bytecode::output(size_t index, size_t pin) const
+{
+    return (m_slots[m_offsets[index] + pin]);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+uint32_t Bytecode::temporary(void)
+{
+    m_values.push_back(Tristate::Undefined);
+    m_latches.push_back(nullptr);
+    return (m_values.size() - 1);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Bytecode::store(uint32_t slot, Tristate value, size_t epoch)
+{
+    m_values[slot] = value;
+    if (m_latches[slot])
+        m_latches[slot]->setState(value, epoch);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+size_t Bytecode::getEvaluations(void) const
+{
+    return (m_evaluations);
+}
+
+} // namespace nts::Engines
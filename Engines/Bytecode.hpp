@@ -0,0 +1,211 @@
+///////////////////////////////////////////////////////////////////////////////
+// Header guard
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Engines/IEngine.hpp"
+#include "Engines/Netlist.hpp"
+#include "Pin.hpp"
+#include <array>
+#include <cstdint>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// Forward declarations
+///////////////////////////////////////////////////////////////////////////////
+namespace nts::Sequencials
+{
+    class FlipFlop;
+    class Counter;
+}
+namespace nts::Components
+{
+    class C4040;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace nts::Engines
+///////////////////////////////////////////////////////////////////////////////
+namespace nts::Engines
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Run a tick as a flat instruction stream over a dense value array
+///
+/// Every OUTPUT pin of the circuit owns one slot of the value array, slot 0
+/// being the undriven net. Components are lowered in levelized order: an
+/// isolated gate, quad gate, 4069, 4008, flip-flop, 4013, counter or 4040
+/// becomes a few instructions reading its input slots directly, while
+/// anything else (inputs, clocks, constants, memories, components in a
+/// feedback loop, side effects) is a NATIVE instruction that simulates the
+/// component itself and copies its latched outputs into the array.
+///
+/// Every written slot is also latched on its pin, so native components,
+/// display and debug see the same values as with the levelized engine, and
+/// sequential instructions drive the state held by the components.
+///
+///////////////////////////////////////////////////////////////////////////////
+class Bytecode : public IEngine
+{
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Instructions, each followed by its operands in the stream
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    enum Opcode : uint32_t
+    {
+        AND2,       //<! a, b, out
+        OR2,        //<! a, b, out
+        XOR2,       //<! a, b, out
+        NAND2,      //<! a, b, out
+        NOR2,       //<! a, b, out
+        NOT,        //<! a, out
+        LUT,        //<! table, a, b, c, out
+        LATCH,      //<! flipflop, clock, data, set, reset, q, qn
+        COUNTER,    //<! counter, clock, reset, out, out
+        RIPPLE,     //<! counter, clock, reset, count, (pin, out)...
+        NATIVE      //<! component, count, (pin, out)...
+    };
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    // Type alias
+    ///////////////////////////////////////////////////////////////////////////
+    using Table = std::array<Tristate, 27>;
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    // Private properties
+    ///////////////////////////////////////////////////////////////////////////
+    Netlist m_netlist;                                  //<!
+    Context* m_context{nullptr};                        //<!
+    std::vector<uint32_t> m_code;                       //<!
+    std::vector<Tristate> m_values;                     //<! Slot values
+    std::vector<Pin*> m_latches;                        //<! Pin per slot
+    std::vector<size_t> m_offsets;                      //<! First pin
+    std::vector<uint32_t> m_slots;                      //<! Slot per pin
+    std::vector<Table> m_tables;                        //<!
+    std::vector<Sequencials::FlipFlop*> m_flipflops;    //<!
+    std::vector<Sequencials::Counter*> m_counters;      //<!
+    std::vector<Components::C4040*> m_ripples;          //<!
+    std::vector<IComponent*> m_natives;                 //<!
+    size_t m_evaluations{0};                            //<!
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param components
+    /// \param context
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void compile(const ComponentMap& components, Context& context) override;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param tick
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void simulate(size_t tick) override;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param count
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void setThreads(size_t count) override;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    size_t getEvaluations(void) const override;
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Append the instructions of one component
+    ///
+    /// \param index
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void lower(size_t index);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param index
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void lowerNative(size_t index);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Chain four full adder stages through temporary carries
+    ///
+    /// \param index
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void lowerAdder(size_t index);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param flipflop
+    /// \param index
+    /// \param pins Input pins then output pins of the latch on the component
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void lowerLatch(
+        Sequencials::FlipFlop& flipflop,
+        size_t index,
+        const std::array<size_t, 6>& pins
+    );
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Slot holding the value read on an input pin
+    ///
+    /// \param index
+    /// \param pin
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    uint32_t input(size_t index, size_t pin) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Slot of an output pin
+    ///
+    /// \param index
+    /// \param pin
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    uint32_t output(size_t index, size_t pin) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Slot not bound to any pin
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    uint32_t temporary(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param slot
+    /// \param value
+    /// \param epoch
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void store(uint32_t slot, Tristate value, size_t epoch);
+};
+
+} // namespace nts::Engines
@@ -0,0 +1,677 @@
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Engines/Codegen.hpp"
+#include "Pin.hpp"
+#include <stdexcept>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace nts::Engines
+///////////////////////////////////////////////////////////////////////////////
+namespace nts::Engines
+{
+
+///////////////////////////////////////////////////////////////////////////////
+// Helpers shared by every generated translation unit
+///////////////////////////////////////////////////////////////////////////////
+static const char* PRELUDE = R"(#include <array>
+#include <csignal>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <stdexcept>
+#include <string>
+
+namespace {
+
+using Tristate = int8_t;
+
+constexpr Tristate U = -1;
+constexpr Tristate F = 0;
+constexpr Tristate T = 1;
+
+inline Tristate not1(Tristate a)
+{
+    return (a == U ? U : a == T ? F : T);
+}
+
+inline Tristate and2(Tristate a, Tristate b)
+{
+    return (a == F || b == F ? F : a == U || b == U ? U : T);
+}
+
+inline Tristate or2(Tristate a, Tristate b)
+{
+    return (a == T || b == T ? T : a == U || b == U ? U : F);
+}
+
+inline Tristate xor2(Tristate a, Tristate b)
+{
+    return (a == U || b == U ? U : a == b ? F : T);
+}
+
+inline Tristate nand2(Tristate a, Tristate b)
+{
+    return (not1(and2(a, b)));
+}
+
+inline Tristate nor2(Tristate a, Tristate b)
+{
+    return (not1(or2(a, b)));
+}
+
+inline Tristate bit(long value, int position)
+{
+    return ((value >> position) & 1 ? T : F);
+}
+
+// Output 0 to 3 is a sum bit, 4 the carry out, as the 4008 computes them
+inline Tristate adder(const Tristate (&a)[4], const Tristate (&b)[4],
+    Tristate carry, int output)
+{
+    Tristate sums[4];
+
+    for (int i = 0; i < 4; i++) {
+        if (a[i] == U || b[i] == U || carry == U) {
+            sums[i] = U;
+            carry = U;
+            continue;
+        }
+        sums[i] = (a[i] ^ b[i] ^ carry) ? T : F;
+        carry = ((a[i] && b[i]) || (carry && (a[i] ^ b[i]))) ? T : F;
+    }
+    return (output < 4 ? sums[output] : carry);
+}
+
+)";
+
+///////////////////////////////////////////////////////////////////////////////
+// Shell reading the same commands as nanotekspice
+///////////////////////////////////////////////////////////////////////////////
+static const char* HARNESS = R"(
+#ifndef NTS_NO_HARNESS
+
+namespace {
+
+char symbol(Tristate value)
+{
+    return (value == U ? 'U' : value == T ? '1' : '0');
+}
+
+void display(const State& s)
+{
+    std::array<Tristate, OUTPUT_NAMES.size()> values;
+
+    outputs(s, values.data());
+    std::cout << "tick: " << s.tick << std::endl;
+    std::cout << "input(s):" << std::endl;
+    for (size_t i = 0; i < INPUT_NAMES.size(); i++)
+        std::cout << "  " << INPUT_NAMES[i] << ": "
+                  << symbol(input(s, i)) << std::endl;
+    std::cout << "output(s):" << std::endl;
+    for (size_t i = 0; i < OUTPUT_NAMES.size(); i++)
+        std::cout << "  " << OUTPUT_NAMES[i] << ": "
+                  << symbol(values[i]) << std::endl;
+}
+
+void simulate(State& s, std::map<size_t, Tristate>& pending)
+{
+    for (const auto& [index, value] : pending)
+        apply(s, index, value);
+    pending.clear();
+    s.tick++;
+    step(s);
+}
+
+template <size_t N>
+bool find(const std::array<const char*, N>& names,
+    const std::string& name, size_t& index)
+{
+    for (index = 0; index < N; index++) {
+        if (name == names[index])
+            return (true);
+    }
+    return (false);
+}
+
+void process(State& s, std::map<size_t, Tristate>& pending,
+    const std::string& command, bool& running)
+{
+    if (command.empty()) return;
+
+    if (command == "exit")      { running = false; return; }
+    if (command == "display")   { display(s); return; }
+    if (command == "simulate")  { simulate(s, pending); return; }
+    if (command == "loop") {
+        while (true) {
+            simulate(s, pending);
+            display(s);
+        }
+    }
+    if (command == "debug" || command.rfind("patterns", 0) == 0)
+        throw std::runtime_error("Not available in compiled circuits: "
+            + command);
+
+    size_t equalPos = command.find('=');
+    if (equalPos != std::string::npos) {
+        std::string name = command.substr(0, equalPos);
+        std::string valueStr = command.substr(equalPos + 1);
+        size_t index = 0;
+
+        Tristate value;
+        if (valueStr == "0")
+            value = F;
+        else if (valueStr == "1")
+            value = T;
+        else if (valueStr == "U")
+            value = U;
+        else
+            throw std::runtime_error("Invalid input value. Use 0, 1, or U.");
+
+        if (find(INPUT_NAMES, name, index)) {
+            pending[index] = value;
+            return;
+        }
+        if (find(COMPONENT_NAMES, name, index))
+            throw std::runtime_error(
+                "Component is not an input or clock: " + name);
+        throw std::runtime_error("Unknown component: " + name);
+    }
+
+    throw std::runtime_error("Unknown command: " + command);
+}
+
+} // namespace
+
+int main(void)
+{
+    State s;
+    std::map<size_t, Tristate> pending;
+    std::string command;
+    bool running = true;
+
+    signal(SIGINT, [](int) { exit(0); });
+    std::cout << "> ";
+    while (running && std::getline(std::cin, command)) {
+        try {
+            process(s, pending, command, running);
+        } catch (const std::exception& e) {
+            std::cerr << e.what() << std::endl;
+        }
+
+        if (running)
+            std::cout << "> ";
+    }
+    return (0);
+}
+
+#endif
+)";
+
+///////////////////////////////////////////////////////////////////////////////
+Codegen::Codegen(const NetTable& nets, const std::vector<std::string>& types)
+    : m_nets(nets)
+    , m_types(types)
+{
+    static const std::map<std::string, std::pair<Kind, std::string>> KINDS = {
+        {"input",       {Kind::INPUT, ""}},
+        {"clock",       {Kind::CLOCK, ""}},
+        {"true",        {Kind::HIGH, ""}},
+        {"false",       {Kind::LOW, ""}},
+        {"output",      {Kind::OUTPUT, ""}},
+        {"and",         {Kind::GATE, "and2"}},
+        {"or",          {Kind::GATE, "or2"}},
+        {"xor",         {Kind::GATE, "xor2"}},
+        {"nand",        {Kind::GATE, "nand2"}},
+        {"nor",         {Kind::GATE, "nor2"}},
+        {"not",         {Kind::NOT, ""}},
+        {"4001",        {Kind::QUAD, "nor2"}},
+        {"4011",        {Kind::QUAD, "nand2"}},
+        {"4030",        {Kind::QUAD, "xor2"}},
+        {"4071",        {Kind::QUAD, "or2"}},
+        {"4081",        {Kind::QUAD, "and2"}},
+        {"4069",        {Kind::HEX_NOT, ""}},
+        {"4008",        {Kind::ADDER, ""}},
+        {"4013",        {Kind::DUAL_FLIPFLOP, ""}},
+        {"flipflop",    {Kind::FLIPFLOP, ""}},
+        {"counter",     {Kind::COUNTER, ""}},
+        {"4040",        {Kind::RIPPLE_COUNTER, ""}}
+    };
+
+    for (uint32_t i = 0; i < m_nets.size(); i++) {
+        auto it = KINDS.find(m_types[i]);
+        if (it == KINDS.end())
+            throw std::runtime_error("Cannot emit C++ for " + describe(i)
+                + ": no compiled model");
+        m_kinds.push_back(it->second.first);
+        m_operators.push_back(it->second.second);
+    }
+    m_netlist.build(m_nets);
+
+    for (uint32_t i = 0; i < m_nets.size(); i++) {
+        const auto& pins = m_nets.getComponent(i)->getPins();
+        for (size_t pin = 0; pin < pins.size(); pin++) {
+            if (pins[pin].getType() == Pin::Type::OUTPUT)
+                m_latches.emplace(Key(i, pin), m_latches.size());
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Codegen::emit(std::ostream& output)
+{
+    output << "// Generated by nanotekspice --emit-cpp, do not edit.\n"
+           << "// Build with: c++ -std=c++20 -O3 -march=native <file>\n\n"
+           << PRELUDE;
+    emitState(output);
+    emitStep(output);
+    emitOutputs(output);
+    output << "} // namespace\n" << HARNESS;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Codegen::emitState(std::ostream& output) const
+{
+    std::vector<uint32_t> inputs;
+    std::vector<std::string> outputs;
+
+    output << "struct State\n{\n"
+           << "    size_t tick = 0;\n"
+           << "    std::array<Tristate, " << m_latches.size()
+           << "> latch{};\n";
+    for (uint32_t i = 0; i < m_nets.size(); i++) {
+        std::string id = std::to_string(i);
+        std::string comment = "    // " + describe(i) + "\n";
+
+        switch (m_kinds[i]) {
+            case Kind::INPUT:
+                output << comment << "    Tristate value_" << id << " = U;\n";
+                inputs.push_back(i);
+                break;
+            case Kind::CLOCK:
+                output << comment << "    Tristate value_" << id << " = U;\n"
+                       << "    bool set_" << id << " = false;\n";
+                inputs.push_back(i);
+                break;
+            case Kind::FLIPFLOP:
+                output << comment << "    Tristate last_" << id << " = U;\n"
+                       << "    Tristate q_" << id << " = F;\n"
+                       << "    Tristate qn_" << id << " = T;\n";
+                break;
+            case Kind::DUAL_FLIPFLOP:
+                output << comment;
+                for (const char* half : {"_0", "_1"})
+                    output << "    Tristate last_" << id << half << " = U;\n"
+                           << "    Tristate q_" << id << half << " = F;\n"
+                           << "    Tristate qn_" << id << half << " = T;\n";
+                break;
+            case Kind::COUNTER:
+                output << comment << "    size_t count_" << id << " = 0;\n"
+                       << "    Tristate last_" << id << " = U;\n";
+                break;
+            case Kind::RIPPLE_COUNTER:
+                output << comment << "    int count_" << id << " = 0;\n"
+                       << "    Tristate last_" << id << " = U;\n";
+                break;
+            case Kind::OUTPUT:
+                outputs.push_back(m_nets.getComponent(i)->getName());
+                break;
+            default:
+                break;
+        }
+    }
+    output << "};\n\n";
+
+    output << "const std::array<const char*, " << m_nets.size()
+           << "> COMPONENT_NAMES = {";
+    for (uint32_t i = 0; i < m_nets.size(); i++)
+        output << (i ? ", " : "") << "\""
+               << m_nets.getComponent(i)->getName() << "\"";
+    output << "};\n\n";
+
+    output << "const std::array<const char*, " << inputs.size()
+           << "> INPUT_NAMES = {";
+    for (size_t i = 0; i < inputs.size(); i++)
+        output << (i ? ", " : "") << "\""
+               << m_nets.getComponent(inputs[i])->getName() << "\"";
+    output << "};\n\n";
+
+    output << "const std::array<const char*, " << outputs.size()
+           << "> OUTPUT_NAMES = {";
+    for (size_t i = 0; i < outputs.size(); i++)
+        output << (i ? ", " : "") << "\"" << outputs[i] << "\"";
+    output << "};\n\n";
+
+    output << "[[maybe_unused]] Tristate input("
+           << "[[maybe_unused]] const State& s, size_t index)"
+           << "\n{\n    switch (index) {\n";
+    for (size_t i = 0; i < inputs.size(); i++)
+        output << "        case " << i << ": return (s.value_"
+               << inputs[i] << ");\n";
+    output << "        default: return (U);\n    }\n}\n\n";
+
+    output << "[[maybe_unused]] void apply([[maybe_unused]] State& s, "
+           << "size_t index, [[maybe_unused]] Tristate value)"
+           << "\n{\n    switch (index) {\n";
+    for (size_t i = 0; i < inputs.size(); i++) {
+        output << "        case " << i << ": s.value_" << inputs[i]
+               << " = value;";
+        if (m_kinds[inputs[i]] == Kind::CLOCK)
+            output << " s.set_" << inputs[i] << " = true;";
+        output << " break;\n";
+    }
+    output << "        default: break;\n    }\n}\n\n";
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Codegen::emitStep(std::ostream& output)
+{
+    const auto& order = m_netlist.getOrder();
+    std::vector<bool> fresh(m_nets.size(), false);
+
+    output << "void step([[maybe_unused]] State& s)\n{\n";
+    for (size_t index : order) {
+        uint32_t component = static_cast<uint32_t>(index);
+        const auto& pins = m_nets.getComponent(component)->getPins();
+
+        openBlock(fresh);
+        emitSimulate(component);
+        for (size_t pin = 0; pin < pins.size(); pin++) {
+            if (pins[pin].getType() != Pin::Type::OUTPUT)
+                continue;
+            std::string value = compute(component, pin);
+            m_block << "        s.latch[" << m_latches.at(Key(component, pin))
+                    << "] = " << value << ";\n";
+        }
+        if (!m_block.str().empty())
+            output << "    { // " << describe(component) << "\n"
+                   << m_block.str() << "    }\n";
+        fresh[component] = true;
+    }
+    output << "}\n\n";
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Codegen::emitOutputs(std::ostream& output)
+{
+    std::vector<uint32_t> outputs;
+
+    for (uint32_t i = 0; i < m_nets.size(); i++) {
+        if (m_kinds[i] == Kind::OUTPUT)
+            outputs.push_back(i);
+    }
+
+    output << "void outputs([[maybe_unused]] const State& s, "
+           << "[[maybe_unused]] Tristate* values)\n{\n";
+    for (bool latched : {false, true}) {
+        openBlock(std::vector<bool>(m_nets.size(), latched));
+        for (size_t i = 0; i < outputs.size(); i++) {
+            std::string value = read(outputs[i], 0);
+            m_block << "        values[" << i << "] = " << value << ";\n";
+        }
+        output << (latched ? "    {\n" : "    if (s.tick == 0) {\n")
+               << m_block.str()
+               << (latched ? "    }\n" : "        return;\n    }\n");
+    }
+    output << "}\n\n";
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Codegen::emitSimulate(uint32_t index)
+{
+    static const size_t FLIPFLOP[] = {0, 1, 2, 3};
+    static const size_t FIRST_HALF[] = {2, 4, 5, 3};
+    static const size_t SECOND_HALF[] = {10, 8, 7, 9};
+
+    switch (m_kinds[index]) {
+        case Kind::CLOCK: {
+            std::string value = field(index, "value");
+            std::string set = field(index, "set");
+            m_block << "        if (" << set << ")\n"
+                    << "            " << set << " = false;\n"
+                    << "        else if (" << value << " != U)\n"
+                    << "            " << value << " = not1(" << value
+                    << ");\n";
+            break;
+        }
+        case Kind::FLIPFLOP:
+            emitFlipFlop(index, "", FLIPFLOP);
+            break;
+        case Kind::DUAL_FLIPFLOP:
+            emitFlipFlop(index, "_0", FIRST_HALF);
+            emitFlipFlop(index, "_1", SECOND_HALF);
+            break;
+        case Kind::COUNTER:
+        case Kind::RIPPLE_COUNTER: {
+            bool ripple = m_kinds[index] == Kind::RIPPLE_COUNTER;
+            std::string clock = read(index, ripple ? 9 : 0);
+            std::string reset = read(index, ripple ? 10 : 1);
+            std::string count = field(index, "count");
+            std::string last = field(index, "last");
+            m_block << "        if (" << reset << " == T)\n"
+                    << "            " << count << " = 0;\n";
+            if (ripple)
+                m_block << "        else if (" << last << " == T && "
+                        << clock << " == F)\n"
+                        << "            " << count << " = (" << count
+                        << " + 1) & 0xFFF;\n";
+            else
+                m_block << "        else if (" << last << " == F && "
+                        << clock << " == T)\n"
+                        << "            " << count << " = (" << count
+                        << " + 1) % 10;\n";
+            m_block << "        " << last << " = " << clock << ";\n";
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Codegen::emitFlipFlop(
+    uint32_t index,
+    const std::string& prefix,
+    const size_t (&pins)[4]
+)
+{
+    std::string clock = read(index, pins[0]);
+    std::string data = read(index, pins[1]);
+    std::string set = read(index, pins[2]);
+    std::string reset = read(index, pins[3]);
+    std::string q = field(index, "q") + prefix;
+    std::string qn = field(index, "qn") + prefix;
+    std::string last = field(index, "last") + prefix;
+
+    m_block << "        if (" << reset << " == T && " << set << " == T) {\n"
+            << "            " << q << " = T;\n"
+            << "            " << qn << " = T;\n"
+            << "        } else if (" << reset << " == T) {\n"
+            << "            " << q << " = F;\n"
+            << "            " << qn << " = T;\n"
+            << "        } else if (" << set << " == T) {\n"
+            << "            " << q << " = T;\n"
+            << "            " << qn << " = F;\n"
+            << "        } else if (" << last << " == F && " << clock
+            << " == T) {\n"
+            << "            " << q << " = " << data << ";\n"
+            << "            " << qn << " = not1(" << data << ");\n"
+            << "        }\n"
+            << "        " << last << " = " << clock << ";\n";
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Codegen::openBlock(std::vector<bool> fresh)
+{
+    m_fresh = std::move(fresh);
+    m_reads.clear();
+    m_active.clear();
+    m_block.str("");
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::string Codegen::read(uint32_t index, size_t pin)
+{
+    const auto& pins = m_nets.getComponent(index)->getPins();
+
+    if (pins[pin].getType() == Pin::Type::ELECTRICAL)
+        return ("U");
+
+    const NetTable::Endpoint& driver = m_nets.getDriver(index, pin);
+    if (driver.component == NetTable::NONE)
+        return ("U");
+
+    Key key(driver.component, driver.pin);
+    auto latch = m_latches.find(key);
+    if (latch != m_latches.end() && m_fresh[driver.component])
+        return ("s.latch[" + std::to_string(latch->second) + "]");
+
+    auto known = m_reads.find(key);
+    if (known != m_reads.end())
+        return (known->second);
+
+    std::string value = compute(driver.component, driver.pin);
+    std::string temp = "t" + std::to_string(m_temps++);
+    m_block << "        const Tristate " << temp << " = " << value << ";\n";
+    m_reads.emplace(key, temp);
+    return (temp);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::string Codegen::compute(uint32_t index, size_t pin)
+{
+    static const std::map<size_t, std::pair<size_t, size_t>> QUAD = {
+        {2, {0, 1}}, {3, {4, 5}}, {9, {7, 8}}, {10, {11, 12}}
+    };
+    static const std::map<size_t, int> RIPPLE = {
+        {0, 11}, {1, 5}, {2, 4}, {3, 6}, {4, 3}, {5, 2},
+        {6, 1}, {8, 0}, {11, 8}, {12, 7}, {13, 9}, {14, 10}
+    };
+    static const size_t ADDER_A[] = {6, 4, 2, 0};
+    static const size_t ADDER_B[] = {5, 3, 1, 14};
+
+    Key key(index, pin);
+    if (!m_active.insert(key).second)
+        throw std::runtime_error("Cannot emit C++ for " + describe(index)
+            + ": combinational loop through pin " + std::to_string(pin + 1));
+
+    std::string value;
+    switch (m_kinds[index]) {
+        case Kind::INPUT:
+        case Kind::CLOCK:
+            value = field(index, "value");
+            break;
+        case Kind::HIGH:
+            value = "T";
+            break;
+        case Kind::LOW:
+            value = "F";
+            break;
+        case Kind::OUTPUT:
+            value = read(index, 0);
+            break;
+        case Kind::GATE:
+            if (pin == 2)
+                value = m_operators[index] + "(" + read(index, 0) + ", "
+                    + read(index, 1) + ")";
+            else
+                value = read(index, pin);
+            break;
+        case Kind::NOT:
+            value = pin == 1
+                ? "not1(" + read(index, 0) + ")"
+                : read(index, pin);
+            break;
+        case Kind::QUAD: {
+            auto gate = QUAD.find(pin);
+            if (pin == 6 || pin == 13)
+                value = "U";
+            else if (gate != QUAD.end())
+                value = m_operators[index] + "("
+                    + read(index, gate->second.first) + ", "
+                    + read(index, gate->second.second) + ")";
+            else
+                value = read(index, pin);
+            break;
+        }
+        case Kind::HEX_NOT:
+            if (pin == 6 || pin == 13)
+                value = "U";
+            else if (pin == 1 || pin == 3 || pin == 5)
+                value = "not1(" + read(index, pin - 1) + ")";
+            else if (pin == 7 || pin == 9 || pin == 11)
+                value = "not1(" + read(index, pin + 1) + ")";
+            else
+                value = read(index, pin);
+            break;
+        case Kind::ADDER:
+            if (pin == 7 || pin == 15)
+                value = "U";
+            else if (pin >= 9 && pin <= 13) {
+                std::string a = "{";
+                std::string b = "{";
+                for (size_t bit = 0; bit < 4; bit++) {
+                    a += (bit ? ", " : "") + read(index, ADDER_A[bit]);
+                    b += (bit ? ", " : "") + read(index, ADDER_B[bit]);
+                }
+                value = "adder(" + a + "}, " + b + "}, " + read(index, 8)
+                    + ", " + std::to_string(pin - 9) + ")";
+            } else
+                value = read(index, pin);
+            break;
+        case Kind::DUAL_FLIPFLOP:
+            if (pin == 6 || pin == 13)
+                value = "U";
+            else if (pin == 1 || pin == 11)
+                value = field(index, "q") + (pin == 1 ? "_0" : "_1");
+            else if (pin == 0 || pin == 12)
+                value = field(index, "qn") + (pin == 0 ? "_0" : "_1");
+            else
+                value = read(index, pin);
+            break;
+        case Kind::FLIPFLOP:
+            if (pin <= 3)
+                value = read(index, pin);
+            else
+                value = field(index, pin == 4 ? "q" : "qn");
+            break;
+        case Kind::COUNTER:
+            if (pin == 2)
+                value = "(" + field(index, "count") + " % 2 ? T : F)";
+            else if (pin == 3)
+                value = "(" + field(index, "count") + " == 9 ? T : F)";
+            else
+                value = read(index, pin);
+            break;
+        case Kind::RIPPLE_COUNTER: {
+            auto bit = RIPPLE.find(pin);
+            if (pin == 7 || pin == 15)
+                value = "U";
+            else if (bit != RIPPLE.end())
+                value = "bit(" + field(index, "count") + ", "
+                    + std::to_string(bit->second) + ")";
+            else
+                value = read(index, pin);
+            break;
+        }
+    }
+    m_active.erase(key);
+    return (value);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::string Codegen::field(uint32_t index, const std::string& field) const
+{
+    return ("s." + field + "_" + std::to_string(index));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::string Codegen::describe(uint32_t index) const
+{
+    return (m_nets.getComponent(index)->getName() + " (" + m_types[index]
+        + ")");
+}
+
+} // namespace nts::Engines
@@ -0,0 +1,208 @@
+///////////////////////////////////////////////////////////////////////////////
+// Header guard
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Engines/NetTable.hpp"
+#include "Engines/Netlist.hpp"
+#include <map>
+#include <ostream>
+#include <set>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace nts::Engines
+///////////////////////////////////////////////////////////////////////////////
+namespace nts::Engines
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Translate a compiled netlist into a standalone C++ simulator
+///
+/// The emitted translation unit keeps the circuit state in one plain struct
+/// and steps it with straight-line code following the levelized schedule.
+/// Like the levelized engine, every component latches its outputs once it
+/// ran, so a read is resolved at generation time: a pin of a component
+/// earlier in the schedule is the latched variable, anything else is pulled
+/// inline, and pulled values are kept in temporaries for the rest of the
+/// component exactly as memoized reads are. The generated program behaves
+/// like `nanotekspice --engine levelized`, shell commands included, unless
+/// it is built with NTS_NO_HARNESS to embed the model elsewhere.
+///
+/// Only components with a known model can be emitted (constants, inputs,
+/// clocks, outputs, gates, 4001/4011/4030/4069/4071/4081, 4008, 4013,
+/// 4040, flip-flops and counters), and combinational loops are rejected
+/// since their values depend on where a read starts.
+///
+///////////////////////////////////////////////////////////////////////////////
+class Codegen
+{
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Component models the generator knows
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    enum class Kind
+    {
+        INPUT,
+        CLOCK,
+        HIGH,
+        LOW,
+        OUTPUT,
+        GATE,
+        NOT,
+        QUAD,
+        HEX_NOT,
+        ADDER,
+        DUAL_FLIPFLOP,
+        FLIPFLOP,
+        COUNTER,
+        RIPPLE_COUNTER
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Type alias
+    ///////////////////////////////////////////////////////////////////////////
+    using Key = std::pair<uint32_t, size_t>;
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    // Private properties
+    ///////////////////////////////////////////////////////////////////////////
+    const NetTable& m_nets;                 //<!
+    std::vector<std::string> m_types;       //<! Factory type per component
+    std::vector<Kind> m_kinds;              //<!
+    std::vector<std::string> m_operators;   //<! Gate function per component
+    Netlist m_netlist;                      //<!
+    std::map<Key, size_t> m_latches;        //<! Latch slot per output pin
+    std::vector<bool> m_fresh;              //<! Latched in the current block
+    std::map<Key, std::string> m_reads;     //<! Temporaries of the block
+    std::set<Key> m_active;                 //<! Pins being computed
+    std::ostringstream m_block;             //<!
+    size_t m_temps{0};                      //<!
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param nets Built net table of the circuit
+    /// \param types Factory type of every component, in net table order
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Codegen(const NetTable& nets, const std::vector<std::string>& types);
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Write the whole translation unit
+    ///
+    /// \param output
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void emit(std::ostream& output);
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param output
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void emitState(std::ostream& output) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Emit one tick, component by component in schedule order
+    ///
+    /// \param output
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void emitStep(std::ostream& output);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Emit the output values as a display command reads them
+    ///
+    /// \param output
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void emitOutputs(std::ostream& output);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Emit the state update of a sequential component
+    ///
+    /// \param index
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void emitSimulate(uint32_t index);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param index
+    /// \param prefix Field prefix of the flip-flop state
+    /// \param pins Pins read as clock, data, set and reset
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void emitFlipFlop(
+        uint32_t index,
+        const std::string& prefix,
+        const size_t (&pins)[4]
+    );
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Start a block where the given components are latched
+    ///
+    /// \param fresh
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void openBlock(std::vector<bool> fresh);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Read an input pin, through its latch or by pulling its driver
+    ///
+    /// \param index
+    /// \param pin
+    ///
+    /// \return Expression holding the value
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    std::string read(uint32_t index, size_t pin);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Expression of a pin value as the component computes it
+    ///
+    /// \param index
+    /// \param pin
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    std::string compute(uint32_t index, size_t pin);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param index
+    /// \param field
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    std::string field(uint32_t index, const std::string& field) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param index
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    std::string describe(uint32_t index) const;
+};
+
+} // namespace nts::Engines
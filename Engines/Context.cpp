@@ -0,0 +1,81 @@
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Engines/Context.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace nts::Engines
+///////////////////////////////////////////////////////////////////////////////
+namespace nts::Engines
+{
+
+///////////////////////////////////////////////////////////////////////////////
+size_t Context::getEpoch(void) const
+{
+    return (m_epoch);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+size_t Context::advance(void)
+{
+    invalidate();
+    return (++m_epoch);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Context::setLatching(bool latching)
+{
+    m_latching = latching;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool Context::isLatching(void) const
+{
+    return (m_latching);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+size_t Context::getSweep(void) const
+{
+    return (m_sweep);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+size_t Context::invalidate(void)
+{
+    return (++m_sweep);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Context::simulate(IComponent& component, size_t tick)
+{
+    component.simulate(tick);
+    if (component.hasChanged())
+        invalidate();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+NetTable& Context::getNets(void)
+{
+    return (m_nets);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+const NetTable& Context::getNets(void) const
+{
+    return (m_nets);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Context::cutOff(void)
+{
+    m_cutoffs.fetch_add(1, std::memory_order_relaxed);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+size_t Context::getCutoffs(void) const
+{
+    return (m_cutoffs.load(std::memory_order_relaxed));
+}
+
+} // namespace nts::Engines
@@ -0,0 +1,145 @@
+///////////////////////////////////////////////////////////////////////////////
+// Header guard
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Engines/NetTable.hpp"
+#include <atomic>
+#include <cstddef>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace nts::Engines
+///////////////////////////////////////////////////////////////////////////////
+namespace nts::Engines
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Simulation state shared by every component of a single circuit
+///
+/// The epoch tells which latched pin states are still valid: a pin stamped
+/// with the current epoch holds an up to date value, any other stamp forces
+/// the reader to compute the driver again.
+///
+/// The sweep is finer grained and bounds memoized reads: it changes at the
+/// start of every tick and whenever a sequential component changes state
+/// while being simulated, so a memoized value is reused only while nothing
+/// it depends on moved. Each pin is then computed once per tick on
+/// combinational logic.
+///
+/// Everything a read needs lives here rather than in static storage, so any
+/// number of circuits can be simulated at the same time on separate threads.
+///
+///////////////////////////////////////////////////////////////////////////////
+class Context
+{
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    // Private properties
+    ///////////////////////////////////////////////////////////////////////////
+    size_t m_epoch{0};      //<!
+    size_t m_sweep{0};      //<!
+    NetTable m_nets;        //<!
+    std::atomic<size_t> m_cutoffs{0};   //<! Reads cut by the cycle guard
+    bool m_latching{false}; //<! Propagated outputs are latched
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    size_t getEpoch(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Invalidate every latched pin state
+    ///
+    /// \return The new epoch
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    size_t advance(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Make components latch the outputs they propagate while being
+    /// simulated, for engines that open an epoch every tick
+    ///
+    /// \param latching
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void setLatching(bool latching);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    bool isLatching(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    size_t getSweep(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Invalidate every memoized pin value
+    ///
+    /// \return The new sweep
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    size_t invalidate(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Simulate a component, invalidating memoized values if its
+    /// state changed
+    ///
+    /// Not thread-safe: concurrent simulations invalidate once around the
+    /// whole batch instead.
+    ///
+    /// \param component
+    /// \param tick
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void simulate(IComponent& component, size_t tick);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    NetTable& getNets(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    const NetTable& getNets(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Record a read cut short by the cycle guard
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void cutOff(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get how many reads were cut short so far
+    ///
+    /// A read may only be memoized when this count did not move while it
+    /// was computed.
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    size_t getCutoffs(void) const;
+};
+
+} // namespace nts::Engines
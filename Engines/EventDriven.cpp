@@ -0,0 +1,152 @@
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Engines/EventDriven.hpp"
+#include <stdexcept>
+#include "Pin.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace nts::Engines
+///////////////////////////////////////////////////////////////////////////////
+namespace nts::Engines
+{
+
+///////////////////////////////////////////////////////////////////////////////
+void EventDriven::compile(const ComponentMap&, Context& context)
+{
+    m_context = &context;
+    m_epoch = context.advance();
+    m_settled = false;
+    m_netlist.build(context.getNets());
+
+    const NetTable& table = context.getNets();
+    const auto& all = m_netlist.getComponents();
+
+    m_nets.clear();
+    m_sources.clear();
+    m_deferred.clear();
+    m_netOffsets.assign(1, 0);
+    m_queued.assign(all.size(), 0);
+    m_buckets.assign(m_netlist.getLevels().size(), {});
+    m_volatile.assign(all.size(), false);
+
+    for (size_t i = 0; i < all.size(); i++) {
+        const auto& pins = all[i]->getPins();
+
+        for (size_t pin = 0; pin < pins.size(); pin++) {
+            if (pins[pin].getType() != Pin::Type::OUTPUT)
+                continue;
+            for (const auto& reader : table.getReaders(i, pin)) {
+                size_t consumer = reader.component;
+                if (consumer == i)
+                    continue;
+                if (m_netlist.getLevel(consumer) <= m_netlist.getLevel(i))
+                    markVolatile(i, m_netlist.getLevel(consumer));
+            }
+            m_nets.push_back(Net{pin, Tristate::Undefined});
+        }
+        m_netOffsets.push_back(m_nets.size());
+    }
+    for (size_t index : m_netlist.getOrder())
+        if (m_netlist.getFanin(index) == 0 || m_volatile[index])
+            m_sources.push_back(index);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void EventDriven::markVolatile(size_t index, size_t level)
+{
+    if (m_volatile[index] || m_netlist.getLevel(index) < level)
+        return;
+    m_volatile[index] = true;
+    for (size_t driver : m_netlist.getDrivers(index))
+        markVolatile(driver, level);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void EventDriven::schedule(size_t index, size_t tick)
+{
+    if (m_queued[index] == tick)
+        return;
+    m_queued[index] = tick;
+    m_buckets[m_netlist.getLevel(index)].push_back(index);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void EventDriven::process(size_t index, size_t level, size_t tick)
+{
+    IComponent* component = m_netlist.getComponents()[index];
+
+    m_evaluations++;
+    m_context->simulate(*component, tick);
+    component->evaluate(m_volatile[index] ? Pin::NEVER : m_epoch);
+
+    const NetTable& table = m_context->getNets();
+    const auto& pins = component->getPins();
+    for (size_t n = m_netOffsets[index]; n < m_netOffsets[index + 1]; n++) {
+        Net& net = m_nets[n];
+        Tristate value = pins[net.pin].getState();
+
+        if (value == net.value)
+            continue;
+        net.value = value;
+        for (const auto& reader : table.getReaders(index, net.pin)) {
+            size_t consumer = reader.component;
+            if (consumer == index)
+                continue;
+            if (m_netlist.getLevel(consumer) > level)
+                schedule(consumer, tick);
+            else
+                m_deferred.push_back(consumer);
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void EventDriven::simulate(size_t tick)
+{
+    m_context->invalidate();    // Inputs were set since the last tick
+    if (!m_settled) {
+        for (size_t index : m_netlist.getOrder())
+            schedule(index, tick);
+        m_settled = true;
+    }
+    for (size_t index : m_sources)
+        schedule(index, tick);
+    for (size_t index : m_deferred)
+        schedule(index, tick);
+    m_deferred.clear();
+
+    try {
+        for (size_t level = 0; level < m_buckets.size(); level++) {
+            for (size_t index : m_buckets[level])
+                process(index, level, tick);
+            m_buckets[level].clear();
+        }
+    } catch (...) {
+        // Changes already recorded on the nets never reached the consumers
+        // left in the buckets, and latched outputs may be stale: drop both,
+        // reads compute again until the next tick visits everything
+        for (auto& bucket : m_buckets)
+            bucket.clear();
+        m_queued.assign(m_queued.size(), 0);
+        m_deferred.clear();
+        m_settled = false;
+        m_epoch = m_context->advance();
+        throw;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void EventDriven::setThreads(size_t count)
+{
+    if (count > 1)
+        throw std::runtime_error("The event engine is single-threaded");
+}
+
+///////////////////////////////////////////////////////////////////////////////
+size_t EventDriven::getEvaluations(void) const
+{
+    return (m_evaluations);
+}
+
+} // namespace nts::Engines
@@ -0,0 +1,135 @@
+///////////////////////////////////////////////////////////////////////////////
+// Header guard
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Engines/IEngine.hpp"
+#include "Engines/Netlist.hpp"
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace nts::Engines
+///////////////////////////////////////////////////////////////////////////////
+namespace nts::Engines
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Selective-trace engine, only evaluating components whose inputs
+/// changed
+///
+/// Every output pin is a net remembering the last value it carried. After a
+/// component is evaluated, only the nets that actually changed schedule their
+/// consumers, bucketed by level so that a component runs at most once per
+/// tick. Components without drivers (inputs, clocks, constants) are visited
+/// on every tick, and a change feeding back to an earlier level is deferred
+/// to the next tick.
+///
+/// Components a feedback reader may pull from before they are processed are
+/// volatile: they are visited on every tick and their outputs are never
+/// latched, so such reads compute the current value exactly like the
+/// interpreted engine does.
+///
+/// A tick interrupted by an exception leaves no work queued and no output
+/// latched, and the next tick visits every component again.
+///
+///////////////////////////////////////////////////////////////////////////////
+class EventDriven : public IEngine
+{
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct Net
+    {
+        size_t pin;                 //<! Output pin of the driver
+        Tristate value;             //<! Last propagated value
+    };
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    // Private properties
+    ///////////////////////////////////////////////////////////////////////////
+    Netlist m_netlist;                          //<!
+    Context* m_context{nullptr};                //<!
+    size_t m_epoch{0};                          //<!
+    bool m_settled{false};                      //<! First tick evaluated
+    std::vector<Net> m_nets;                    //<!
+    std::vector<size_t> m_netOffsets;           //<! Nets per component
+    std::vector<size_t> m_sources;              //<!
+    std::vector<size_t> m_queued;               //<! Last queued tick
+    std::vector<std::vector<size_t>> m_buckets; //<! Worklist per level
+    std::vector<size_t> m_deferred;             //<! Queued for next tick
+    std::vector<bool> m_volatile;               //<! Never latched
+    size_t m_evaluations{0};                    //<!
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param components
+    /// \param context
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void compile(const ComponentMap& components, Context& context) override;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param tick
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void simulate(size_t tick) override;
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Mark the fan-in cone of a feedback driver as volatile, down to
+    /// the level of the component reading it
+    ///
+    /// \param index
+    /// \param level
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void markVolatile(size_t index, size_t level);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param index
+    /// \param tick
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void schedule(size_t index, size_t tick);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Evaluate a component and schedule the consumers of its changed
+    /// nets
+    ///
+    /// \param index
+    /// \param level
+    /// \param tick
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void process(size_t index, size_t level, size_t tick);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param count
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void setThreads(size_t count) override;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    size_t getEvaluations(void) const override;
+};
+
+} // namespace nts::Engines
@@ -0,0 +1,80 @@
+///////////////////////////////////////////////////////////////////////////////
+// Header guard
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "IComponent.hpp"
+#include "Engines/Context.hpp"
+#include <map>
+#include <memory>
+#include <string>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace nts::Engines
+///////////////////////////////////////////////////////////////////////////////
+namespace nts::Engines
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Strategy used by a circuit to step its components through a tick
+///
+///////////////////////////////////////////////////////////////////////////////
+class IEngine
+{
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    // Type alias
+    ///////////////////////////////////////////////////////////////////////////
+    using ComponentMap = std::map<std::string, std::shared_ptr<IComponent>>;
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Default destructor
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    virtual ~IEngine() = default;
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Build the engine internal representation of the netlist
+    ///
+    /// \param components
+    /// \param context
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    virtual void compile(
+        const ComponentMap& components,
+        Context& context
+    ) = 0;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Run every component of the compiled netlist for one tick
+    ///
+    /// \param tick
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    virtual void simulate(size_t tick) = 0;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Set how many threads may evaluate a tick
+    ///
+    /// Single-threaded engines throw for anything above one.
+    ///
+    /// \param count
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    virtual void setThreads(size_t count) = 0;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get how many component evaluations the engine ran so far
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    virtual size_t getEvaluations(void) const = 0;
+};
+
+} // namespace nts::Engines
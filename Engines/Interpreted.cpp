@@ -0,0 +1,46 @@
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Engines/Interpreted.hpp"
+#include <stdexcept>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace nts::Engines
+///////////////////////////////////////////////////////////////////////////////
+namespace nts::Engines
+{
+
+///////////////////////////////////////////////////////////////////////////////
+void Interpreted::compile(const ComponentMap& components, Context& context)
+{
+    m_context = &context;
+    m_context->advance();
+    m_components.clear();
+    m_components.reserve(components.size());
+    for (const auto& [name, component] : components)
+        m_components.push_back(component.get());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Interpreted::simulate(size_t tick)
+{
+    m_context->invalidate();    // Inputs were set since the last tick
+    for (IComponent* component : m_components)
+        m_context->simulate(*component, tick);
+    m_evaluations += m_components.size();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Interpreted::setThreads(size_t count)
+{
+    if (count > 1)
+        throw std::runtime_error("The interpreted engine is single-threaded");
+}
+
+///////////////////////////////////////////////////////////////////////////////
+size_t Interpreted::getEvaluations(void) const
+{
+    return (m_evaluations);
+}
+
+} // namespace nts::Engines
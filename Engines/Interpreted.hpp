@@ -0,0 +1,67 @@
+///////////////////////////////////////////////////////////////////////////////
+// Header guard
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Engines/IEngine.hpp"
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace nts::Engines
+///////////////////////////////////////////////////////////////////////////////
+namespace nts::Engines
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Simulate components in name order, each one pulling its inputs
+///
+///////////////////////////////////////////////////////////////////////////////
+class Interpreted : public IEngine
+{
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    // Private properties
+    ///////////////////////////////////////////////////////////////////////////
+    std::vector<IComponent*> m_components;  //<!
+    Context* m_context{nullptr};            //<!
+    size_t m_evaluations{0};                //<!
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param components
+    /// \param context
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void compile(const ComponentMap& components, Context& context) override;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param tick
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void simulate(size_t tick) override;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param count
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void setThreads(size_t count) override;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    size_t getEvaluations(void) const override;
+};
+
+} // namespace nts::Engines
@@ -0,0 +1,81 @@
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Engines/Levelized.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace nts::Engines
+///////////////////////////////////////////////////////////////////////////////
+namespace nts::Engines
+{
+
+///////////////////////////////////////////////////////////////////////////////
+// Smallest level worth waking the worker pool for
+///////////////////////////////////////////////////////////////////////////////
+static constexpr size_t MIN_PARALLEL_LEVEL = 64;
+
+///////////////////////////////////////////////////////////////////////////////
+void Levelized::compile(const ComponentMap&, Context& context)
+{
+    m_context = &context;
+    m_context->setLatching(true);
+    m_netlist.build(context.getNets());
+    m_schedule.clear();
+    m_schedule.reserve(m_netlist.getOrder().size());
+    for (size_t index : m_netlist.getOrder())
+        m_schedule.push_back(m_netlist.getComponents()[index]);
+
+    const auto& levels = m_netlist.getLevels();
+    m_parallel.assign(levels.size() - 1, false);
+    for (size_t level = 0; level + 1 < levels.size(); level++) {
+        if (levels[level + 1] - levels[level] < MIN_PARALLEL_LEVEL)
+            continue;
+        bool isolated = true;
+        for (size_t i = levels[level]; isolated && i < levels[level + 1]; i++)
+            isolated = m_netlist.isIsolated(m_netlist.getOrder()[i]);
+        m_parallel[level] = isolated;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Levelized::simulate(size_t tick)
+{
+    size_t epoch = m_context->advance();
+    const auto& levels = m_netlist.getLevels();
+
+    m_evaluations += m_schedule.size();
+    for (size_t level = 0; level + 1 < levels.size(); level++) {
+        IComponent* const* first = m_schedule.data() + levels[level];
+        size_t count = levels[level + 1] - levels[level];
+
+        if (m_pool && m_parallel[level]) {
+            m_pool->run(count, [first, tick, epoch](size_t i) {
+                first[i]->simulate(tick);
+                first[i]->settle(epoch);
+            });
+            m_context->invalidate();
+            continue;
+        }
+        for (size_t i = 0; i < count; i++) {
+            m_context->simulate(*first[i], tick);
+            first[i]->settle(epoch);
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Levelized::setThreads(size_t count)
+{
+    if (count > 1)
+        m_pool = std::make_unique<WorkerPool>(count);
+    else
+        m_pool.reset();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+size_t Levelized::getEvaluations(void) const
+{
+    return (m_evaluations);
+}
+
+} // namespace nts::Engines
@@ -0,0 +1,84 @@
+///////////////////////////////////////////////////////////////////////////////
+// Header guard
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Engines/IEngine.hpp"
+#include "Engines/Netlist.hpp"
+#include "Engines/WorkerPool.hpp"
+#include <memory>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace nts::Engines
+///////////////////////////////////////////////////////////////////////////////
+namespace nts::Engines
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Evaluate each component exactly once per tick in level order
+///
+/// Every tick opens a new epoch and every component latches its outputs for
+/// it right after being simulated, so consumers placed on a later level read
+/// the stored pin state instead of walking the driver cone again. Outputs a
+/// component propagates while simulated are latched as they are set, only
+/// the others are computed afterwards.
+///
+/// With more than one thread, a level whose components only read latched
+/// pins of earlier levels and have no side effects is split across a worker
+/// pool, with a barrier before the next level. Every other level runs in
+/// order on the calling thread, so results match the single-threaded run.
+///
+///////////////////////////////////////////////////////////////////////////////
+class Levelized : public IEngine
+{
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    // Private properties
+    ///////////////////////////////////////////////////////////////////////////
+    Netlist m_netlist;                      //<!
+    Context* m_context{nullptr};            //<!
+    std::vector<IComponent*> m_schedule;    //<!
+    std::vector<bool> m_parallel;           //<! Levels safe to split
+    std::unique_ptr<WorkerPool> m_pool;     //<!
+    size_t m_evaluations{0};                //<!
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param components
+    /// \param context
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void compile(const ComponentMap& components, Context& context) override;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param tick
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void simulate(size_t tick) override;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param count
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void setThreads(size_t count) override;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    size_t getEvaluations(void) const override;
+};
+
+} // namespace nts::Engines
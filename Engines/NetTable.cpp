@@ -0,0 +1,114 @@
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Engines/NetTable.hpp"
+#include "Pin.hpp"
+#include <unordered_map>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace nts::Engines
+///////////////////////////////////////////////////////////////////////////////
+namespace nts::Engines
+{
+
+///////////////////////////////////////////////////////////////////////////////
+void NetTable::build(const ComponentMap& components)
+{
+    std::unordered_map<const IComponent*, uint32_t> indices;
+
+    clear();
+    m_components.reserve(components.size());
+    m_slots.reserve(components.size() + 1);
+    m_slots.push_back(0);
+    for (const auto& [name, component] : components) {
+        indices[component.get()] = m_components.size();
+        component->setIndex(m_components.size());
+        m_components.push_back(component.get());
+        m_slots.push_back(m_slots.back() + component->getPins().size());
+    }
+
+    m_drivers.assign(m_slots.back(), Endpoint{NONE, 0});
+    m_offsets.assign(m_slots.back() + 1, 0);
+    for (uint32_t i = 0; i < m_components.size(); i++) {
+        const auto& pins = m_components[i]->getPins();
+
+        for (size_t pin = 0; pin < pins.size(); pin++) {
+            if (pins[pin].getType() != Pin::Type::INPUT)
+                continue;
+            for (const Link& link : pins[pin].getLinks()) {
+                auto it = indices.find(link.component.lock().get());
+                if (it == indices.end())
+                    continue;
+                Endpoint driver{it->second, static_cast<uint32_t>(link.pin)};
+                m_drivers[m_slots[i] + pin] = driver;
+                m_offsets[m_slots[driver.component] + driver.pin + 1]++;
+                break;
+            }
+        }
+    }
+
+    for (size_t slot = 1; slot < m_offsets.size(); slot++)
+        m_offsets[slot] += m_offsets[slot - 1];
+    m_readers.resize(m_offsets.back());
+
+    std::vector<uint32_t> fill(m_offsets.begin(), m_offsets.end() - 1);
+    for (uint32_t i = 0; i < m_components.size(); i++) {
+        for (uint32_t slot = m_slots[i]; slot < m_slots[i + 1]; slot++) {
+            const Endpoint& driver = m_drivers[slot];
+            if (driver.component == NONE)
+                continue;
+            m_readers[fill[m_slots[driver.component] + driver.pin]++] =
+                Endpoint{i, slot - m_slots[i]};
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void NetTable::clear(void)
+{
+    m_components.clear();
+    m_slots.clear();
+    m_drivers.clear();
+    m_offsets.clear();
+    m_readers.clear();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+uint32_t NetTable::size(void) const
+{
+    return (m_components.size());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+IComponent* NetTable::getComponent(uint32_t index) const
+{
+    return (m_components[index]);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+const std::vector<IComponent*>& NetTable::getComponents(void) const
+{
+    return (m_components);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+const NetTable::Endpoint& NetTable::getDriver(uint32_t index, size_t pin) const
+{
+    return (m_drivers[m_slots[index] + pin]);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::span<const NetTable::Endpoint> NetTable::getReaders(
+    uint32_t index,
+    size_t pin
+) const
+{
+    uint32_t slot = m_slots[index] + pin;
+
+    return (std::span<const Endpoint>(
+        m_readers.data() + m_offsets[slot],
+        m_offsets[slot + 1] - m_offsets[slot]
+    ));
+}
+
+} // namespace nts::Engines
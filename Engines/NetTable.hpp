@@ -0,0 +1,132 @@
+///////////////////////////////////////////////////////////////////////////////
+// Header guard
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "IComponent.hpp"
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace nts::Engines
+///////////////////////////////////////////////////////////////////////////////
+namespace nts::Engines
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Flat, index-based copy of the circuit connectivity
+///
+/// Components are numbered in name order and every pin of every component
+/// owns a slot in one contiguous array. An input slot records the pin
+/// driving it (the first link of the pin, as the simulator always read it)
+/// and the pins a slot drives are stored as a CSR adjacency, so evaluation
+/// never goes through the Link weak pointers. The Pin/Link graph stays the
+/// source of truth and the table is rebuilt whenever it changes.
+///
+///////////////////////////////////////////////////////////////////////////////
+class NetTable
+{
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    // Type alias
+    ///////////////////////////////////////////////////////////////////////////
+    using ComponentMap = std::map<std::string, std::shared_ptr<IComponent>>;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief A pin of a component, by index
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct Endpoint
+    {
+        uint32_t component;     //<!
+        uint32_t pin;           //<!
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Index of a missing component
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr uint32_t NONE = std::numeric_limits<uint32_t>::max();
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    // Private properties
+    ///////////////////////////////////////////////////////////////////////////
+    std::vector<IComponent*> m_components;  //<! Name order
+    std::vector<uint32_t> m_slots;          //<! First slot per component
+    std::vector<Endpoint> m_drivers;        //<! Driver per slot
+    std::vector<uint32_t> m_offsets;        //<! First reader per slot
+    std::vector<Endpoint> m_readers;        //<! Readers grouped by driver
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Number the components and lower their links
+    ///
+    /// \param components
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void build(const ComponentMap& components);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Drop the table, readers fall back to the links
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void clear(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    uint32_t size(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param index
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    IComponent* getComponent(uint32_t index) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    const std::vector<IComponent*>& getComponents(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the pin driving a pin, NONE as component if unlinked
+    ///
+    /// \param index
+    /// \param pin
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    const Endpoint& getDriver(uint32_t index, size_t pin) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the pins reading a pin
+    ///
+    /// \param index
+    /// \param pin
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    std::span<const Endpoint> getReaders(uint32_t index, size_t pin) const;
+};
+
+} // namespace nts::Engines
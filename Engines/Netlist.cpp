@@ -0,0 +1,172 @@
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Engines/Netlist.hpp"
+#include "Pin.hpp"
+#include <algorithm>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace nts::Engines
+///////////////////////////////////////////////////////////////////////////////
+namespace nts::Engines
+{
+
+///////////////////////////////////////////////////////////////////////////////
+void Netlist::build(const NetTable& nets)
+{
+    m_components = nets.getComponents();
+    connect(nets);
+    levelize();
+    classify(nets);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Netlist::connect(const NetTable& nets)
+{
+    m_fanout.assign(m_components.size(), {});
+    m_drivers.assign(m_components.size(), {});
+    m_fanin.assign(m_components.size(), 0);
+
+    for (size_t i = 0; i < m_components.size(); i++) {
+        std::vector<size_t> drivers;
+
+        const auto& pins = m_components[i]->getPins();
+        for (size_t pin = 0; pin < pins.size(); pin++) {
+            const NetTable::Endpoint& driver = nets.getDriver(i, pin);
+            if (driver.component == NetTable::NONE || driver.component == i)
+                continue;
+            const auto& source = m_components[driver.component]->getPins();
+            if (source[driver.pin].getType() != Pin::Type::OUTPUT)
+                continue;
+            drivers.push_back(driver.component);
+        }
+
+        std::sort(drivers.begin(), drivers.end());
+        drivers.erase(std::unique(drivers.begin(), drivers.end()),
+            drivers.end());
+        for (size_t driver : drivers)
+            m_fanout[driver].push_back(i);
+        m_fanin[i] = drivers.size();
+        m_drivers[i] = std::move(drivers);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Netlist::levelize(void)
+{
+    std::vector<size_t> pending(m_fanin);
+    std::vector<bool> placed(m_components.size(), false);
+    std::vector<size_t> frontier;
+    size_t nextUnplaced = 0;
+
+    m_order.clear();
+    m_order.reserve(m_components.size());
+    m_levels.assign(1, 0);
+    m_levelOf.assign(m_components.size(), 0);
+
+    for (size_t i = 0; i < m_components.size(); i++) {
+        if (pending[i] == 0)
+            frontier.push_back(i);
+    }
+
+    while (m_order.size() < m_components.size()) {
+        if (frontier.empty()) {
+            while (placed[nextUnplaced])
+                nextUnplaced++;
+            frontier.push_back(nextUnplaced);
+        }
+
+        std::vector<size_t> next;
+        for (size_t index : frontier) {
+            placed[index] = true;
+            m_levelOf[index] = m_levels.size() - 1;
+            m_order.push_back(index);
+        }
+        for (size_t index : frontier) {
+            for (size_t consumer : m_fanout[index]) {
+                if (!placed[consumer] && pending[consumer] > 0 &&
+                    --pending[consumer] == 0)
+                    next.push_back(consumer);
+            }
+        }
+        std::sort(next.begin(), next.end());
+        m_levels.push_back(m_order.size());
+        frontier = std::move(next);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Netlist::classify(const NetTable& nets)
+{
+    m_isolated.assign(m_components.size(), true);
+
+    for (size_t i = 0; i < m_components.size(); i++) {
+        const auto& pins = m_components[i]->getPins();
+
+        if (m_components[i]->hasSideEffects()) {
+            m_isolated[i] = false;
+            continue;
+        }
+        for (size_t pin = 0; m_isolated[i] && pin < pins.size(); pin++) {
+            if (pins[pin].getType() != Pin::Type::INPUT)
+                continue;
+            const NetTable::Endpoint& driver = nets.getDriver(i, pin);
+            if (driver.component == NetTable::NONE)
+                continue;
+            const auto& source = m_components[driver.component]->getPins();
+            m_isolated[i] = driver.component != i &&
+                m_levelOf[driver.component] < m_levelOf[i] &&
+                source[driver.pin].getType() == Pin::Type::OUTPUT;
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+const std::vector<IComponent*>& Netlist::getComponents(void) const
+{
+    return (m_components);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+size_t Netlist::getLevel(size_t index) const
+{
+    return (m_levelOf[index]);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+size_t Netlist::getFanin(size_t index) const
+{
+    return (m_fanin[index]);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+const std::vector<size_t>& Netlist::getDrivers(size_t index) const
+{
+    return (m_drivers[index]);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+const std::vector<size_t>& Netlist::getFanout(size_t index) const
+{
+    return (m_fanout[index]);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+const std::vector<size_t>& Netlist::getOrder(void) const
+{
+    return (m_order);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+const std::vector<size_t>& Netlist::getLevels(void) const
+{
+    return (m_levels);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool Netlist::isIsolated(size_t index) const
+{
+    return (m_isolated[index]);
+}
+
+} // namespace nts::Engines
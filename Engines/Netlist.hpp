@@ -0,0 +1,155 @@
+///////////////////////////////////////////////////////////////////////////////
+// Header guard
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Engines/NetTable.hpp"
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace nts::Engines
+///////////////////////////////////////////////////////////////////////////////
+namespace nts::Engines
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Flattened view of a circuit, levelized in topological order
+///
+/// Components are indexed as in the net table. A component depends on every
+/// component driving one of its input pins, and the evaluation order puts
+/// drivers before their consumers. Feedback loops are broken by releasing
+/// the first remaining component in name order.
+///
+///////////////////////////////////////////////////////////////////////////////
+class Netlist
+{
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    // Private properties
+    ///////////////////////////////////////////////////////////////////////////
+    std::vector<IComponent*> m_components;          //<! Name order
+    std::vector<std::vector<size_t>> m_fanout;      //<! Consumers per driver
+    std::vector<std::vector<size_t>> m_drivers;     //<! Drivers per consumer
+    std::vector<size_t> m_fanin;                    //<! Driver count
+    std::vector<size_t> m_order;                    //<! Evaluation order
+    std::vector<size_t> m_levels;                   //<! Level offsets
+    std::vector<size_t> m_levelOf;                  //<! Level per component
+    std::vector<bool> m_isolated;                   //<! Reads latched pins
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param nets
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void build(const NetTable& nets);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    const std::vector<IComponent*>& getComponents(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param index
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    size_t getLevel(size_t index) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the number of distinct components driving a component
+    ///
+    /// \param index
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    size_t getFanin(size_t index) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param index
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    const std::vector<size_t>& getDrivers(size_t index) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param index
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    const std::vector<size_t>& getFanout(size_t index) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the component indices in evaluation order
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    const std::vector<size_t>& getOrder(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the offsets of each level in the evaluation order
+    ///
+    /// Level `i` spans `[getLevels()[i], getLevels()[i + 1])`.
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    const std::vector<size_t>& getLevels(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Tell if a component only reads pins latched on earlier levels
+    ///
+    /// Such a component has no side effects and every input is driven by an
+    /// output pin of another component on a strictly lower level, so it can
+    /// run concurrently with anything that does not drive it.
+    ///
+    /// \param index
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    bool isIsolated(size_t index) const;
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param nets
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void connect(const NetTable& nets);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void levelize(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param nets
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void classify(const NetTable& nets);
+};
+
+} // namespace nts::Engines
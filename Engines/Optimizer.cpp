@@ -0,0 +1,401 @@
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Engines/Optimizer.hpp"
+#include "Engines/Netlist.hpp"
+#include "Pin.hpp"
+#include <algorithm>
+#include <map>
+#include <utility>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace nts::Engines
+///////////////////////////////////////////////////////////////////////////////
+namespace nts::Engines
+{
+
+///////////////////////////////////////////////////////////////////////////////
+// Output pin of each gate of a quad package, followed by its two inputs
+///////////////////////////////////////////////////////////////////////////////
+static constexpr size_t QUAD_GATES[4][3] = {
+    {2, 0, 1}, {3, 4, 5}, {9, 7, 8}, {10, 11, 12}
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// Output pin of each inverter of a 4069, followed by its input
+///////////////////////////////////////////////////////////////////////////////
+static constexpr size_t HEX_INVERTERS[6][2] = {
+    {1, 0}, {3, 2}, {5, 4}, {7, 8}, {9, 10}, {11, 12}
+};
+
+///////////////////////////////////////////////////////////////////////////////
+static bool operator==(const NetTable::Endpoint& lhs,
+    const NetTable::Endpoint& rhs)
+{
+    return (lhs.component == rhs.component && lhs.pin == rhs.pin);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+static Optimizer::Signal wire(uint32_t index, size_t pin)
+{
+    return (Optimizer::Signal{Optimizer::Signal::Kind::WIRE,
+        {index, static_cast<uint32_t>(pin)}, Tristate::Undefined});
+}
+
+///////////////////////////////////////////////////////////////////////////////
+static Optimizer::Signal constant(Tristate value)
+{
+    return (Optimizer::Signal{Optimizer::Signal::Kind::CONSTANT,
+        {NetTable::NONE, 0}, value});
+}
+
+///////////////////////////////////////////////////////////////////////////////
+static bool isWire(const Optimizer::Signal& signal)
+{
+    return (signal.kind == Optimizer::Signal::Kind::WIRE);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+static bool isConstant(const Optimizer::Signal& signal)
+{
+    return (signal.kind == Optimizer::Signal::Kind::CONSTANT);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Optimizer::Optimizer(
+    const NetTable& nets,
+    const std::vector<std::string>& types
+)
+    : m_nets(nets)
+{
+    static const std::map<std::string, Operator> GATES = {
+        {"and", Operator::AND}, {"or", Operator::OR},
+        {"xor", Operator::XOR}, {"nand", Operator::NAND},
+        {"nor", Operator::NOR}
+    };
+    static const std::map<std::string, Operator> QUADS = {
+        {"4081", Operator::AND}, {"4071", Operator::OR},
+        {"4030", Operator::XOR}, {"4011", Operator::NAND},
+        {"4001", Operator::NOR}
+    };
+
+    m_slices.resize(types.size());
+    m_offsets.assign(1, 0);
+    for (uint32_t i = 0; i < types.size(); i++) {
+        const std::string& type = types[i];
+        std::vector<Slice>& slices = m_slices[i];
+
+        m_offsets.push_back(m_offsets.back() +
+            m_nets.getComponent(i)->getPins().size());
+        if (auto gate = GATES.find(type); gate != GATES.end())
+            slices.push_back({gate->second, {0, 1}, 2});
+        else if (auto quad = QUADS.find(type); quad != QUADS.end()) {
+            for (const auto& [out, a, b] : QUAD_GATES)
+                slices.push_back({quad->second, {a, b}, out});
+        } else if (type == "not")
+            slices.push_back({Operator::NOT, {0}, 1});
+        else if (type == "4069") {
+            for (const auto& [out, in] : HEX_INVERTERS)
+                slices.push_back({Operator::NOT, {in}, out});
+        } else if (type == "4008") {
+            for (size_t out = 9; out <= 13; out++)
+                slices.push_back({Operator::OPAQUE,
+                    {0, 1, 2, 3, 4, 5, 6, 8, 14}, out});
+        } else if (type == "true") {
+            slices.push_back({Operator::HIGH, {}, 0});
+            if (m_high == NetTable::NONE)
+                m_high = i;
+        } else if (type == "false") {
+            slices.push_back({Operator::LOW, {}, 0});
+            if (m_low == NetTable::NONE)
+                m_low = i;
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Optimizer::Report Optimizer::run(void)
+{
+    Netlist netlist;
+
+    m_report = Report();
+    m_signals.clear();
+    for (uint32_t i = 0; i < m_slices.size(); i++) {
+        for (size_t pin = 0; pin < m_offsets[i + 1] - m_offsets[i]; pin++)
+            m_signals.push_back(wire(i, pin));
+    }
+    m_inverts.assign(m_signals.size(), std::nullopt);
+    m_structures.clear();
+
+    netlist.build(m_nets);
+    for (size_t index : netlist.getOrder()) {
+        const std::vector<Slice>& slices = m_slices[index];
+        bool constant = !slices.empty() && (slices[0].op == Operator::HIGH
+            || slices[0].op == Operator::LOW);
+        if (!constant && !netlist.isIsolated(index))
+            continue;
+        for (const Slice& slice : slices) {
+            m_signals[slot(index, slice.output)] =
+                merge(index, slice, fold(index, slice));
+        }
+    }
+
+    mark();
+    m_removed.assign(m_slices.size(), false);
+    for (uint32_t i = 0; i < m_slices.size(); i++) {
+        if (m_slices[i].empty())
+            continue;
+        bool live = false;
+        for (size_t s = m_offsets[i]; !live && s < m_offsets[i + 1]; s++)
+            live = m_live[s];
+        m_removed[i] = !live;
+        m_report.removed += !live;
+    }
+    return (m_report);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool Optimizer::isRemoved(uint32_t index) const
+{
+    return (m_removed[index]);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool Optimizer::isLive(uint32_t index, size_t pin) const
+{
+    return (m_slices[index].empty() || m_live[slot(index, pin)]);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+const std::vector<Optimizer::Rewire>& Optimizer::getRewires(void) const
+{
+    return (m_rewires);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Optimizer::Signal Optimizer::fold(uint32_t index, const Slice& slice)
+{
+    Signal self = wire(index, slice.output);
+
+    if (slice.op == Operator::HIGH)
+        return (constant(Tristate::True));
+    if (slice.op == Operator::LOW)
+        return (constant(Tristate::False));
+    if (slice.op == Operator::OPAQUE)
+        return (self);
+    if (slice.op == Operator::NOT)
+        return (invert(read(index, slice.inputs[0]), self));
+
+    Signal a = read(index, slice.inputs[0]);
+    Signal b = read(index, slice.inputs[1]);
+    if (isConstant(a) && isConstant(b)) {
+        Tristate value = Tristate::Undefined;
+        switch (slice.op) {
+            case Operator::AND:     value = a.value & b.value; break;
+            case Operator::OR:      value = a.value | b.value; break;
+            case Operator::XOR:     value = a.value ^ b.value; break;
+            case Operator::NAND:    value = ~(a.value & b.value); break;
+            case Operator::NOR:     value = ~(a.value | b.value); break;
+            default:                break;
+        }
+        if (value == Tristate::Undefined)
+            return (self);
+        m_report.folded++;
+        return (constant(value));
+    }
+    if (isConstant(a))
+        std::swap(a, b);
+    if (!isConstant(b) || b.value == Tristate::Undefined)
+        return (self);
+
+    // b is now a known level: the gate either forces its output or
+    // passes a, possibly inverted
+    bool high = b.value == Tristate::True;
+    Tristate forced = Tristate::Undefined;
+    bool inverted = false;
+    switch (slice.op) {
+        case Operator::AND:
+            forced = high ? Tristate::Undefined : Tristate::False;
+            break;
+        case Operator::OR:
+            forced = high ? Tristate::True : Tristate::Undefined;
+            break;
+        case Operator::NAND:
+            forced = high ? Tristate::Undefined : Tristate::True;
+            inverted = true;
+            break;
+        case Operator::NOR:
+            forced = high ? Tristate::False : Tristate::Undefined;
+            inverted = true;
+            break;
+        case Operator::XOR:
+            inverted = high;
+            break;
+        default:
+            break;
+    }
+    if (forced != Tristate::Undefined) {
+        m_report.folded++;
+        return (constant(forced));
+    }
+    if (inverted)
+        return (invert(a, self));
+    if (!isWire(a))
+        return (self);
+    m_report.folded++;
+    return (a);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Optimizer::Signal Optimizer::invert(const Signal& signal, const Signal& self)
+{
+    if (isConstant(signal)) {
+        if (signal.value == Tristate::Undefined)
+            return (self);
+        m_report.folded++;
+        return (constant(~signal.value));
+    }
+    if (!isWire(signal))
+        return (self);
+
+    const std::optional<Signal>& original =
+        m_inverts[slot(signal.wire.component, signal.wire.pin)];
+    if (original) {
+        m_report.collapsed++;
+        return (*original);
+    }
+    m_inverts[slot(self.wire.component, self.wire.pin)] = signal;
+    return (self);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Optimizer::Signal Optimizer::merge(
+    uint32_t index,
+    const Slice& slice,
+    const Signal& signal
+)
+{
+    auto operand = [this, index](size_t pin) {
+        Signal input = read(index, pin);
+        return (Operand{input.kind, input.wire.component, input.wire.pin,
+            input.value});
+    };
+
+    // Constants and bypassed gates are already simplified further
+    if (slice.op == Operator::OPAQUE
+        || !(isWire(signal) && signal.wire == wire(index, slice.output).wire))
+        return (signal);
+
+    Operand a = operand(slice.inputs[0]);
+    Operand b;
+    if (slice.inputs.size() > 1)
+        b = operand(slice.inputs[1]);
+    // Gates left unconnected in a package are not worth reporting
+    if (std::get<0>(a) == Signal::Kind::CONSTANT
+        && (slice.op == Operator::NOT
+            || std::get<0>(b) == Signal::Kind::CONSTANT))
+        return (signal);
+    // Every two-input primitive is commutative
+    if (b < a)
+        std::swap(a, b);
+    auto [it, inserted] = m_structures.insert({{slice.op, a, b}, signal});
+    if (inserted)
+        return (signal);
+    m_report.merged++;
+    return (it->second);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Optimizer::Signal Optimizer::read(uint32_t index, size_t pin) const
+{
+    const NetTable::Endpoint& driver = m_nets.getDriver(index, pin);
+
+    if (driver.component == NetTable::NONE)
+        return (constant(Tristate::Undefined));
+    const auto& pins = m_nets.getComponent(driver.component)->getPins();
+    if (pins[driver.pin].getType() != Pin::Type::OUTPUT)
+        return (Signal{Signal::Kind::OPAQUE, driver, Tristate::Undefined});
+    return (resolve(m_signals[slot(driver.component, driver.pin)]));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Optimizer::Signal Optimizer::resolve(Signal signal) const
+{
+    for (size_t step = 0; step < m_signals.size() && isWire(signal); step++) {
+        const Signal& next =
+            m_signals[slot(signal.wire.component, signal.wire.pin)];
+        if (isWire(next) && next.wire == signal.wire)
+            break;
+        signal = next;
+    }
+    return (signal);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Optimizer::mark(void)
+{
+    std::vector<std::pair<uint32_t, size_t>> pending;
+    auto need = [this, &pending](uint32_t index, size_t pin) {
+        if (m_live[slot(index, pin)])
+            return;
+        m_live[slot(index, pin)] = true;
+        pending.emplace_back(index, pin);
+    };
+
+    m_live.assign(m_signals.size(), false);
+    m_rewires.clear();
+    for (uint32_t i = 0; i < m_slices.size(); i++) {
+        if (!m_slices[i].empty())
+            continue;
+        const auto& pins = m_nets.getComponent(i)->getPins();
+        for (size_t pin = 0; pin < pins.size(); pin++) {
+            if (pins[pin].getType() == Pin::Type::INPUT)
+                need(i, pin);
+        }
+    }
+
+    while (!pending.empty()) {
+        auto [index, pin] = pending.back();
+        pending.pop_back();
+
+        const auto& pins = m_nets.getComponent(index)->getPins();
+        if (pins[pin].getType() != Pin::Type::INPUT) {
+            for (const Slice& slice : m_slices[index]) {
+                if (slice.output != pin)
+                    continue;
+                for (size_t input : slice.inputs)
+                    need(index, input);
+            }
+            continue;
+        }
+
+        const NetTable::Endpoint& driver = m_nets.getDriver(index, pin);
+        if (driver.component == NetTable::NONE)
+            continue;
+        Signal source = read(index, pin);
+        bool folded = isConstant(source) ||
+            (isWire(source) && !(source.wire == driver));
+        const auto& slices = m_slices[driver.component];
+        if (!folded || slices.empty() || slices[0].op == Operator::HIGH ||
+            slices[0].op == Operator::LOW) {
+            need(driver.component, driver.pin);
+            continue;
+        }
+        if (isConstant(source)) {
+            uint32_t owner = source.value == Tristate::True ? m_high : m_low;
+            if (owner != NetTable::NONE)
+                source = wire(owner, 0);
+        }
+        if (isWire(source))
+            need(source.wire.component, source.wire.pin);
+        m_rewires.push_back({index, pin, source});
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+size_t Optimizer::slot(uint32_t index, size_t pin) const
+{
+    return (m_offsets[index] + pin);
+}
+
+} // namespace nts::Engines
@@ -0,0 +1,269 @@
+///////////////////////////////////////////////////////////////////////////////
+// Header guard
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Engines/NetTable.hpp"
+#include "Tristate.hpp"
+#include <map>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace nts::Engines
+///////////////////////////////////////////////////////////////////////////////
+namespace nts::Engines
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Simplify a netlist without changing what its outputs show
+///
+/// Gates, quad gates, 4069 and 4008 packages and constants are the only
+/// components the pass may touch, and only the isolated ones are folded so
+/// feedback loops keep their timing. Walking the levelized order, it folds
+/// `true`/`false` values through the gate primitives, replaces a gate that
+/// only passes one of its inputs through by that input, and replaces an
+/// inversion of an inversion by the original signal. A gate computing the
+/// same function of the same signals as an earlier one is merged into it.
+/// Consumers of a folded output are then rewired to the constant or to the
+/// original driver.
+///
+/// Every other component is a root. A pin is live when a root reads it,
+/// directly or through the inputs of the gate slices computing it, and a
+/// touchable component with no live pin is removed. Inputs of the unused
+/// slices of a package that stays are reported dead so their links can go.
+///
+///////////////////////////////////////////////////////////////////////////////
+class Optimizer
+{
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Value seen on a pin once the netlist is simplified
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct Signal
+    {
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief
+        ///
+        ///////////////////////////////////////////////////////////////////////
+        enum class Kind
+        {
+            WIRE,       //<! Value of an output pin
+            CONSTANT,   //<! Value known at load time
+            OPAQUE      //<! Read through a pin that is not an output
+        };
+
+        Kind kind;                  //<!
+        NetTable::Endpoint wire;    //<!
+        Tristate value;             //<!
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief New driver of an input pin
+    ///
+    /// A constant source is either the output of a `true`/`false` component
+    /// already in the circuit, or a Signal::Kind::CONSTANT when there is none
+    /// and the caller has to add it.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct Rewire
+    {
+        uint32_t component;         //<!
+        size_t pin;                 //<!
+        Signal source;              //<!
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief What the pass achieved
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct Report
+    {
+        size_t folded{0};           //<! Outputs bypassed or made constant
+        size_t collapsed{0};        //<! Double inversions removed
+        size_t merged{0};           //<! Gates duplicating an earlier one
+        size_t removed{0};          //<! Components without live pins
+    };
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Function of one output of a touchable component
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    enum class Operator
+    {
+        AND,
+        OR,
+        XOR,
+        NAND,
+        NOR,
+        NOT,
+        HIGH,
+        LOW,
+        OPAQUE
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief One output of a touchable component and the pins it reads
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct Slice
+    {
+        Operator op;                //<!
+        std::vector<size_t> inputs; //<!
+        size_t output;              //<!
+    };
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    // Type alias
+    ///////////////////////////////////////////////////////////////////////////
+    using Operand = std::tuple<Signal::Kind, uint32_t, uint32_t, Tristate>;
+    using Structure = std::tuple<Operator, Operand, Operand>;
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    // Private properties
+    ///////////////////////////////////////////////////////////////////////////
+    const NetTable& m_nets;                         //<!
+    std::vector<std::vector<Slice>> m_slices;       //<! Empty for roots
+    std::vector<size_t> m_offsets;                  //<! First pin
+    std::vector<Signal> m_signals;                  //<! Per pin
+    std::vector<std::optional<Signal>> m_inverts;   //<! Signal a pin inverts
+    std::map<Structure, Signal> m_structures;       //<! First gate of each
+    std::vector<bool> m_live;                       //<! Per pin
+    std::vector<bool> m_removed;                    //<!
+    std::vector<Rewire> m_rewires;                  //<!
+    uint32_t m_high{NetTable::NONE};                //<! First `true`
+    uint32_t m_low{NetTable::NONE};                 //<! First `false`
+    Report m_report;                                //<!
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param nets Built net table of the circuit
+    /// \param types Factory type of every component, in net table order
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Optimizer(const NetTable& nets, const std::vector<std::string>& types);
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Report run(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param index
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    bool isRemoved(uint32_t index) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Whether a kept component still needs the links of a pin
+    ///
+    /// \param index
+    /// \param pin
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    bool isLive(uint32_t index, size_t pin) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    const std::vector<Rewire>& getRewires(void) const;
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param index
+    /// \param slice
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Signal fold(uint32_t index, const Slice& slice);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param signal
+    /// \param self Output computing the inversion
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Signal invert(const Signal& signal, const Signal& self);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Hash a gate kept by fold() on its function and input signals
+    ///
+    /// \param index
+    /// \param slice
+    /// \param signal Result of fold()
+    ///
+    /// \return The output of the first identical gate, or `signal`
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Signal merge(uint32_t index, const Slice& slice, const Signal& signal);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Signal read on an input pin
+    ///
+    /// \param index
+    /// \param pin
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Signal read(uint32_t index, size_t pin) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Follow wires to outputs that were folded after being read
+    ///
+    /// \param signal
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Signal resolve(Signal signal) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Mark the pins every root depends on, recording rewires
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void mark(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param index
+    /// \param pin
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    size_t slot(uint32_t index, size_t pin) const;
+};
+
+} // namespace nts::Engines
@@ -0,0 +1,207 @@
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Engines/WorkStealing.hpp"
+#include <algorithm>
+#include <thread>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace nts::Engines
+///////////////////////////////////////////////////////////////////////////////
+namespace nts::Engines
+{
+
+///////////////////////////////////////////////////////////////////////////////
+// Smallest run of isolated components worth a task graph
+///////////////////////////////////////////////////////////////////////////////
+static constexpr size_t MIN_PARALLEL_SEGMENT = 64;
+
+///////////////////////////////////////////////////////////////////////////////
+WorkStealing::WorkStealing(void)
+{
+    setThreads(1);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void WorkStealing::compile(const ComponentMap&, Context& context)
+{
+    m_context = &context;
+    m_netlist.build(context.getNets());
+
+    const auto& order = m_netlist.getOrder();
+    std::vector<size_t> position(order.size());
+    m_schedule.clear();
+    m_schedule.reserve(order.size());
+    for (size_t i = 0; i < order.size(); i++) {
+        position[order[i]] = i;
+        m_schedule.push_back(m_netlist.getComponents()[order[i]]);
+    }
+
+    m_segments.clear();
+    for (size_t i = 0; i < order.size();) {
+        size_t last = i + 1;
+        if (m_netlist.isIsolated(order[i])) {
+            while (last < order.size() && m_netlist.isIsolated(order[last]))
+                last++;
+        }
+        bool parallel = last - i >= MIN_PARALLEL_SEGMENT;
+        if (parallel)
+            m_segments.push_back({i, last, true});
+        else {
+            for (; i < last; i++)
+                m_segments.push_back({i, i + 1, false});
+        }
+        i = last;
+    }
+
+    std::vector<std::vector<size_t>> consumers(order.size());
+    m_fanin.assign(order.size(), 0);
+    for (const Segment& segment : m_segments) {
+        if (!segment.parallel)
+            continue;
+        for (size_t i = segment.first; i < segment.last; i++) {
+            for (size_t driver : m_netlist.getDrivers(order[i])) {
+                if (position[driver] < segment.first)
+                    continue;
+                consumers[position[driver]].push_back(i);
+                m_fanin[i]++;
+            }
+        }
+    }
+    m_offsets.assign(1, 0);
+    m_consumers.clear();
+    for (const auto& list : consumers) {
+        m_consumers.insert(m_consumers.end(), list.begin(), list.end());
+        m_offsets.push_back(m_consumers.size());
+    }
+    m_pending = std::make_unique<std::atomic<size_t>[]>(order.size());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void WorkStealing::simulate(size_t tick)
+{
+    size_t epoch = m_context->advance();
+
+    m_evaluations += m_schedule.size();
+    for (const Segment& segment : m_segments) {
+        if (segment.parallel) {
+            runSegment(segment, tick, epoch);
+            continue;
+        }
+        m_context->simulate(*m_schedule[segment.first], tick);
+        m_schedule[segment.first]->evaluate(epoch);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void WorkStealing::runSegment(
+    const Segment& segment,
+    size_t tick,
+    size_t epoch
+)
+{
+    size_t worker = 0;
+
+    m_failedAt = segment.last;
+    m_error = nullptr;
+    m_remaining.store(segment.last - segment.first, std::memory_order_relaxed);
+    for (size_t i = segment.first; i < segment.last; i++) {
+        m_pending[i].store(m_fanin[i], std::memory_order_relaxed);
+        if (m_fanin[i] == 0)
+            push(worker++ % m_deques.size(), i);
+    }
+
+    if (m_pool) {
+        m_pool->run(m_pool->size(), [this, tick, epoch](size_t id) {
+            work(id, tick, epoch);
+        });
+    } else
+        work(0, tick, epoch);
+    m_context->invalidate();
+    if (m_error)
+        std::rethrow_exception(m_error);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void WorkStealing::work(size_t worker, size_t tick, size_t epoch)
+{
+    size_t position = 0;
+
+    while (m_remaining.load(std::memory_order_acquire) > 0) {
+        if (!take(worker, position)) {
+            std::this_thread::yield();
+            continue;
+        }
+        try {
+            m_schedule[position]->simulate(tick);
+            m_schedule[position]->evaluate(epoch);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(m_errorMutex);
+            if (position < m_failedAt) {
+                m_failedAt = position;
+                m_error = std::current_exception();
+            }
+        }
+        size_t last = m_offsets[position + 1];
+        for (size_t i = m_offsets[position]; i < last; i++) {
+            size_t consumer = m_consumers[i];
+            if (m_pending[consumer].fetch_sub(1,
+                    std::memory_order_acq_rel) == 1)
+                push(worker, consumer);
+        }
+        m_remaining.fetch_sub(1, std::memory_order_acq_rel);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void WorkStealing::push(size_t worker, size_t position)
+{
+    Deque& deque = *m_deques[worker];
+    std::lock_guard<std::mutex> lock(deque.mutex);
+
+    deque.tasks.push_back(position);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool WorkStealing::take(size_t worker, size_t& position)
+{
+    {
+        Deque& own = *m_deques[worker];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if (!own.tasks.empty()) {
+            position = own.tasks.back();
+            own.tasks.pop_back();
+            return (true);
+        }
+    }
+    for (size_t i = 1; i < m_deques.size(); i++) {
+        Deque& victim = *m_deques[(worker + i) % m_deques.size()];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.tasks.empty()) {
+            position = victim.tasks.front();
+            victim.tasks.pop_front();
+            return (true);
+        }
+    }
+    return (false);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void WorkStealing::setThreads(size_t count)
+{
+    m_deques.clear();
+    for (size_t i = 0; i < std::max<size_t>(count, 1); i++)
+        m_deques.push_back(std::make_unique<Deque>());
+    if (count > 1)
+        m_pool = std::make_unique<WorkerPool>(count);
+    else
+        m_pool.reset();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+size_t WorkStealing::getEvaluations(void) const
+{
+    return (m_evaluations);
+}
+
+} // namespace nts::Engines
@@ -0,0 +1,169 @@
+///////////////////////////////////////////////////////////////////////////////
+// Header guard
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Engines/IEngine.hpp"
+#include "Engines/Netlist.hpp"
+#include "Engines/WorkerPool.hpp"
+#include <atomic>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace nts::Engines
+///////////////////////////////////////////////////////////////////////////////
+namespace nts::Engines
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Dataflow engine releasing each component once its drivers are done
+///
+/// The evaluation order is cut into segments. A run of isolated components
+/// (see `Netlist::isIsolated`) forms one task graph: every component is a
+/// task waiting on its drivers of the same segment, and a finished task
+/// releases its consumers on the deque of the worker that ran it. Workers
+/// pop their own deque from the back and steal from the front of the
+/// others, so a long ripple chain does not hold a whole level hostage the
+/// way a level barrier does.
+///
+/// Any other component is a segment of its own, run alone on the calling
+/// thread once everything before it in the order is done, which keeps the
+/// results identical to the levelized engine.
+///
+///////////////////////////////////////////////////////////////////////////////
+class WorkStealing : public IEngine
+{
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Range of the evaluation order run as one unit
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct Segment
+    {
+        size_t first;               //<!
+        size_t last;                //<!
+        bool parallel;              //<! Run as a task graph
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Ready tasks of one worker
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct alignas(64) Deque
+    {
+        std::mutex mutex;           //<!
+        std::deque<size_t> tasks;   //<! Positions in the order
+    };
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    // Private properties
+    ///////////////////////////////////////////////////////////////////////////
+    Netlist m_netlist;                              //<!
+    Context* m_context{nullptr};                    //<!
+    std::vector<IComponent*> m_schedule;            //<!
+    std::vector<Segment> m_segments;                //<!
+    std::vector<size_t> m_offsets;                  //<! First consumer
+    std::vector<size_t> m_consumers;                //<! Same segment only
+    std::vector<size_t> m_fanin;                    //<! Drivers in segment
+    std::unique_ptr<std::atomic<size_t>[]> m_pending; //<! Drivers left
+    std::atomic<size_t> m_remaining{0};             //<! Tasks left
+    std::vector<std::unique_ptr<Deque>> m_deques;   //<! One per worker
+    std::unique_ptr<WorkerPool> m_pool;             //<!
+    std::mutex m_errorMutex;                        //<!
+    size_t m_failedAt{0};                           //<! Lowest failing task
+    std::exception_ptr m_error;                     //<!
+    size_t m_evaluations{0};                        //<!
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    WorkStealing(void);
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param components
+    /// \param context
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void compile(const ComponentMap& components, Context& context) override;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param tick
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void simulate(size_t tick) override;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param count
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void setThreads(size_t count) override;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    size_t getEvaluations(void) const override;
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Run the task graph of a segment on every worker
+    ///
+    /// \param segment
+    /// \param tick
+    /// \param epoch
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void runSegment(const Segment& segment, size_t tick, size_t epoch);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Run tasks until the current segment is drained
+    ///
+    /// \param worker
+    /// \param tick
+    /// \param epoch
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void work(size_t worker, size_t tick, size_t epoch);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param worker
+    /// \param position
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void push(size_t worker, size_t position);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Take the newest task of a worker, or steal the oldest task of
+    /// another one
+    ///
+    /// \param worker
+    /// \param position
+    ///
+    /// \return false when every deque is empty
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    bool take(size_t worker, size_t& position);
+};
+
+} // namespace nts::Engines
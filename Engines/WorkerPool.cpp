@@ -0,0 +1,108 @@
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Engines/WorkerPool.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace nts::Engines
+///////////////////////////////////////////////////////////////////////////////
+namespace nts::Engines
+{
+
+///////////////////////////////////////////////////////////////////////////////
+WorkerPool::WorkerPool(size_t threads)
+{
+    for (size_t worker = 1; worker < threads; worker++)
+        m_threads.emplace_back(&WorkerPool::work, this, worker);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+WorkerPool::~WorkerPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = true;
+    }
+    m_start.notify_all();
+    for (std::thread& thread : m_threads)
+        thread.join();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+size_t WorkerPool::size(void) const
+{
+    return (m_threads.size() + 1);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void WorkerPool::run(size_t count, const Task& task)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_task = &task;
+        m_count = count;
+        m_pending = m_threads.size();
+        m_failedAt = count;
+        m_error = nullptr;
+        m_generation++;
+    }
+    m_start.notify_all();
+
+    runChunk(0, task, count);
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_done.wait(lock, [this]() { return (m_pending == 0); });
+    m_task = nullptr;
+    if (m_error)
+        std::rethrow_exception(m_error);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void WorkerPool::work(size_t worker)
+{
+    size_t seen = 0;
+
+    while (true) {
+        const Task* task = nullptr;
+        size_t count = 0;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_start.wait(lock, [this, seen]() {
+                return (m_stopping || m_generation != seen);
+            });
+            if (m_stopping)
+                return;
+            seen = m_generation;
+            task = m_task;
+            count = m_count;
+        }
+
+        runChunk(worker, *task, count);
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (--m_pending == 0)
+            m_done.notify_one();
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void WorkerPool::runChunk(size_t worker, const Task& task, size_t count)
+{
+    size_t first = count * worker / size();
+    size_t last = count * (worker + 1) / size();
+
+    for (size_t index = first; index < last; index++) {
+        try {
+            task(index);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (index < m_failedAt) {
+                m_failedAt = index;
+                m_error = std::current_exception();
+            }
+            return;
+        }
+    }
+}
+
+} // namespace nts::Engines
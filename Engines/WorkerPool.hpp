@@ -0,0 +1,112 @@
+///////////////////////////////////////////////////////////////////////////////
+// Header guard
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace nts::Engines
+///////////////////////////////////////////////////////////////////////////////
+namespace nts::Engines
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Fixed set of threads running index ranges with a barrier
+///
+/// `run` splits [0, count) into one contiguous chunk per thread, the calling
+/// thread taking the first one, and returns once every chunk is done. When
+/// tasks throw, the exception of the lowest index is rethrown so failures
+/// are reported the same way whatever the thread count.
+///
+///////////////////////////////////////////////////////////////////////////////
+class WorkerPool
+{
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    // Type alias
+    ///////////////////////////////////////////////////////////////////////////
+    using Task = std::function<void(size_t)>;
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    // Private properties
+    ///////////////////////////////////////////////////////////////////////////
+    std::vector<std::thread> m_threads;     //<!
+    std::mutex m_mutex;                     //<!
+    std::condition_variable m_start;        //<!
+    std::condition_variable m_done;         //<!
+    const Task* m_task{nullptr};            //<!
+    size_t m_count{0};                      //<! Indices of the current run
+    size_t m_generation{0};                 //<! Runs started so far
+    size_t m_pending{0};                    //<! Workers still running
+    size_t m_failedAt{0};                   //<! Lowest index that threw
+    std::exception_ptr m_error;             //<!
+    bool m_stopping{false};                 //<!
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param threads Total thread count, including the calling thread
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    explicit WorkerPool(size_t threads);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    ~WorkerPool();
+
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    size_t size(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Run a task for every index and wait for all of them
+    ///
+    /// \param count
+    /// \param task
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void run(size_t count, const Task& task);
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param worker
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void work(size_t worker);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Run the chunk of a worker, recording the first failure
+    ///
+    /// \param worker
+    /// \param task
+    /// \param count
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void runChunk(size_t worker, const Task& task, size_t count);
+};
+
+} // namespace nts::Engines
@@ -7,6 +7,7 @@
 // Dependencies
 ///////////////////////////////////////////////////////////////////////////////
 #include "IComponent.hpp"
+#include "Arena.hpp"
 #include <unordered_map>
 #include <functional>
 #include <memory>
@@ -71,7 +72,10 @@ private:
     {
         m_factories[type] = [](const std::string& name) ->
             std::shared_ptr<IComponent> {
-                return std::make_shared<T>(name);
+                return std::allocate_shared<T>(
+                    std::pmr::polymorphic_allocator<T>(Arena::getCurrent()),
+                    name
+                );
             };
     }
 };
@@ -28,4 +28,14 @@ Tristate Not::compute(size_t pin)
     return (getInputState(pin));
 }
 
+///////////////////////////////////////////////////////////////////////////////
+Tristate64 Not::compute64(size_t pin)
+{
+    if (pin >= m_pins.size())
+        throw OutOfRangePinException();
+    if (pin == 1)
+        return (~(getInputState64(0)));
+    return (getInputState64(pin));
+}
+
 } // namespace nts::Gates
@@ -29,4 +29,14 @@ Tristate Or::compute(size_t pin)
     return (getInputState(pin));
 }
 
+///////////////////////////////////////////////////////////////////////////////
+Tristate64 Or::compute64(size_t pin)
+{
+    if (pin >= m_pins.size())
+        throw OutOfRangePinException();
+    if (pin == 2)
+        return (getInputState64(0) | getInputState64(1));
+    return (getInputState64(pin));
+}
+
 } // namespace nts::Gates
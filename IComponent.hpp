@@ -7,8 +7,11 @@
 // Dependencies
 ///////////////////////////////////////////////////////////////////////////////
 #include "Tristate.hpp"
+#include "Tristate64.hpp"
+#include <cstdint>
 #include <iostream>
 #include <memory>
+#include <memory_resource>
 #include <vector>
 
 #ifdef NTS_BONUS
@@ -35,6 +38,16 @@ namespace nts
 ///////////////////////////////////////////////////////////////////////////////
 class Pin;
 
+///////////////////////////////////////////////////////////////////////////////
+// Pre-definition of the state buffer
+///////////////////////////////////////////////////////////////////////////////
+class Snapshot;
+
+///////////////////////////////////////////////////////////////////////////////
+// Pre-definition of the simulation context
+///////////////////////////////////////////////////////////////////////////////
+namespace Engines { class Context; }
+
 ///////////////////////////////////////////////////////////////////////////////
 /// \brief
 ///
@@ -67,6 +80,84 @@ public:
     ///////////////////////////////////////////////////////////////////////////
     virtual Tristate compute(size_t pin) = 0;
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Compute a pin for 64 independent input patterns at once
+    ///
+    /// \param pin
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    virtual Tristate64 compute64(size_t pin) = 0;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Compute every output pin once and latch it for the given epoch
+    ///
+    /// \param epoch
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    virtual void evaluate(size_t epoch) = 0;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Latch for the given epoch the output pins simulate did not
+    /// already latch
+    ///
+    /// \param epoch
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    virtual void settle(size_t epoch) = 0;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Bind the component to the context of its circuit
+    ///
+    /// \param context
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    virtual void setContext(Engines::Context* context) = 0;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Set the index of the component in the net table of its context
+    ///
+    /// \param index
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    virtual void setIndex(uint32_t index) = 0;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Tell if simulating the component touches anything outside of
+    /// it, in which case it is never simulated concurrently with others
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    virtual bool hasSideEffects(void) const = 0;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Tell if the last simulation wrote the state of the component,
+    /// which may change what compute returns for the same inputs
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    virtual bool hasChanged(void) const = 0;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Append everything simulation changes: pin states, latches,
+    /// counts, memory
+    ///
+    /// \param snapshot
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    virtual void saveState(Snapshot& snapshot) const = 0;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Read back what saveState wrote
+    ///
+    /// \param snapshot
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    virtual void loadState(Snapshot& snapshot) = 0;
+
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
     ///
@@ -95,7 +186,7 @@ public:
     /// \return
     ///
     ///////////////////////////////////////////////////////////////////////////
-    virtual std::vector<Pin>& getPins(void) = 0;
+    virtual std::pmr::vector<Pin>& getPins(void) = 0;
 
 #ifdef NTS_BONUS
     //////////////////////////////////////////////////////////////////////////
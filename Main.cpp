@@ -1,24 +1,185 @@
 ///////////////////////////////////////////////////////////////////////////////
 // Dependencies
 ///////////////////////////////////////////////////////////////////////////////
+#include "Shell/Farm.hpp"
 #include "Shell/Shell.hpp"
+#include "Shell/TraceReader.hpp"
 #include "Errors/ParsingException.hpp"
 #include <iostream>
+#include <string>
+#include <vector>
 
 #ifndef NTS_BONUS
 
 ///////////////////////////////////////////////////////////////////////////////
+static void report(const nts::Engines::Optimizer::Report& report)
+{
+    std::cerr << "Optimized: " << report.removed << " components removed, "
+              << report.folded << " outputs folded, " << report.collapsed
+              << " double inversions collapsed, " << report.merged
+              << " duplicate gates merged" << std::endl;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+static void readTrace(const std::string& filename, size_t from, size_t to)
+{
+    nts::TraceReader reader(filename);
+    std::string line = "tick";
+
+    for (const std::string& name : reader.getSignals())
+        line += " " + name;
+    std::cout << line << '\n';
+    reader.read(from, to, [&line](size_t tick, const auto& values) {
+        line = std::to_string(tick);
+        for (nts::Tristate value : values) {
+            line += ' ';
+            line += (value == nts::Tristate::Undefined) ? 'U'
+                : (value == nts::Tristate::True) ? '1' : '0';
+        }
+        std::cout << line << '\n';
+    });
+}
+
+///////////////////////////////////////////////////////////////////////////////
+static int usage(const char* binary)
+{
+    std::cerr << "Usage: " << binary
+              << " [--engine <interpreted|levelized|event|stealing|bytecode>]"
+              << " [--threads <n>] [--optimize] [--compact]"
+              << " [--script <file>] [--trace <file>] [--history <MiB>]"
+              << " [--fast-forward] <circuit_file>"
+              << std::endl
+              << "       " << binary
+              << " --emit-cpp [--optimize] <circuit_file>"
+              << std::endl
+              << "       " << binary
+              << " [--engine <name>] [--threads <n>] [--optimize]"
+              << " [--compact] --farm <workers>"
+              << " <circuit_file> <script>..."
+              << std::endl
+              << "       " << binary
+              << " --read-trace <trace_file> [<from> [<to>]]"
+              << std::endl;
+    return (84);
+}
+
 int main(int argc, char* argv[])
 {
-    if (argc != 2) {
-        std::cerr << "Usage: " << argv[0] << " <circuit_file>" << std::endl;
-        return (84);
+    std::string engine = "interpreted";
+    std::string filename;
+    std::vector<std::string> scripts;
+    std::string script;
+    std::string trace;
+    size_t threads = 1;
+    size_t workers = 0;
+    size_t history = 0;
+    bool emitCpp = false;
+    bool optimize = false;
+    bool compact = false;
+    bool fastForward = false;
+
+    if (argc >= 3 && argc <= 5 && std::string(argv[1]) == "--read-trace") {
+        try {
+            size_t from = argc > 3 ? std::stoul(argv[3]) : 0;
+            size_t to = argc > 4 ? std::stoul(argv[4]) : SIZE_MAX;
+            readTrace(argv[2], from, to);
+        } catch (const std::invalid_argument&) {
+            return (usage(argv[0]));
+        } catch (const std::exception& e) {
+            std::cerr << e.what() << std::endl;
+            return (84);
+        }
+        return (0);
+    }
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+
+        if (arg == "--engine" && i + 1 < argc)
+            engine = argv[++i];
+        else if (arg == "--threads" && i + 1 < argc) {
+            try {
+                threads = std::stoul(argv[++i]);
+            } catch (const std::exception&) {
+                return (usage(argv[0]));
+            }
+            if (threads == 0)
+                return (usage(argv[0]));
+        }
+        else if (arg == "--emit-cpp")
+            emitCpp = true;
+        else if (arg == "--optimize")
+            optimize = true;
+        else if (arg == "--compact")
+            compact = true;
+        else if (arg == "--fast-forward")
+            fastForward = true;
+        else if (arg == "--script" && i + 1 < argc)
+            script = argv[++i];
+        else if ((arg == "--trace" || arg == "--vcd") && i + 1 < argc)
+            trace = argv[++i];
+        else if (arg == "--history" && i + 1 < argc) {
+            try {
+                history = std::stoul(argv[++i]);
+            } catch (const std::exception&) {
+                return (usage(argv[0]));
+            }
+            if (history == 0)
+                return (usage(argv[0]));
+        }
+        else if (arg == "--farm" && i + 1 < argc) {
+            try {
+                workers = std::stoul(argv[++i]);
+            } catch (const std::exception&) {
+                return (usage(argv[0]));
+            }
+            if (workers == 0)
+                return (usage(argv[0]));
+        }
+        else if (filename.empty() && arg.rfind("--", 0) != 0)
+            filename = arg;
+        else if (arg.rfind("--", 0) != 0)
+            scripts.push_back(arg);
+        else
+            return (usage(argv[0]));
     }
+    if (filename.empty() || (workers == 0) != scripts.empty())
+        return (usage(argv[0]));
+    if ((emitCpp || !script.empty() || !trace.empty() || history > 0
+        || fastForward) && workers > 0)
+        return (usage(argv[0]));
+    if (emitCpp && (!script.empty() || !trace.empty()))
+        return (usage(argv[0]));
 
     try {
+        if (workers > 0) {
+            nts::Farm farm;
+            farm.setEngine(engine);
+            farm.setThreads(threads);
+            farm.setCompact(compact);
+            farm.loadCircuit(filename);
+            if (optimize)
+                report(farm.optimize());
+            return (farm.run(scripts, workers) == 0 ? 0 : 84);
+        }
         nts::Shell shell;
-        shell.loadCircuit(argv[1]);
-        shell.run();
+        shell.setEngine(engine);
+        shell.setThreads(threads);
+        shell.setCompact(compact);
+        shell.loadCircuit(filename);
+        if (optimize)
+            report(shell.optimize());
+        if (!trace.empty())
+            shell.trace(trace);
+        if (history > 0)
+            shell.setHistory(history);
+        shell.setFastForward(fastForward);
+        if (emitCpp)
+            shell.emitCpp();
+        else if (!script.empty())
+            shell.runScript(script);
+        else
+            shell.run();
     } catch (const nts::ParsingException& e) {
         std::cerr << e.what() << std::endl;
         return (84);
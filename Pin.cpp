@@ -2,6 +2,7 @@
 // Dependencies
 ///////////////////////////////////////////////////////////////////////////////
 #include "Pin.hpp"
+#include "Arena.hpp"
 #include <algorithm>
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -12,15 +13,89 @@ namespace nts
 
 ///////////////////////////////////////////////////////////////////////////////
 Pin::Pin(Pin::Type type, const std::string& name)
-    : m_state(Tristate::Undefined)
+    : m_links(Arena::getCurrent())
+    , m_state(Tristate::Undefined)
     , m_type(type)
-    , m_name(name)
+    , m_name(name, Arena::getCurrent())
+    , m_stamp(NEVER)
+    , m_memo(Tristate::Undefined)
+    , m_sweep(NEVER)
+    , m_pattern()
+    , m_patternSweep(NEVER)
+    , m_busy(NEVER)
 {}
 
 ///////////////////////////////////////////////////////////////////////////////
 void Pin::setState(Tristate state)
 {
     m_state = state;
+    m_stamp = NEVER;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Pin::setState(Tristate state, size_t epoch)
+{
+    m_state = state;
+    m_stamp = epoch;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool Pin::isFresh(size_t epoch) const
+{
+    return (m_stamp == epoch);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Pin::memoize(Tristate state, size_t sweep)
+{
+    m_memo = state;
+    m_sweep = sweep;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool Pin::isMemoized(size_t sweep) const
+{
+    return (m_sweep == sweep);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Tristate Pin::getMemo(void) const
+{
+    return (m_memo);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Pin::memoizePattern(const Tristate64& pattern, size_t sweep)
+{
+    m_pattern = pattern;
+    m_patternSweep = sweep;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool Pin::isPatternMemoized(size_t sweep) const
+{
+    return (m_patternSweep == sweep);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+const Tristate64& Pin::getPattern(void) const
+{
+    return (m_pattern);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool Pin::enter(size_t sweep)
+{
+    if (m_busy == sweep)
+        return (false);
+    m_busy = sweep;
+    return (true);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Pin::leave(void)
+{
+    m_busy = NEVER;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -55,7 +130,7 @@ void Pin::removeLink(const std::shared_ptr<IComponent>& component, size_t pin)
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-const std::vector<Link>& Pin::getLinks(void) const
+const std::pmr::vector<Link>& Pin::getLinks(void) const
 {
     return (m_links);
 }
@@ -75,7 +150,7 @@ void Pin::clearLinks(void)
 ///////////////////////////////////////////////////////////////////////////////
 std::string Pin::getName(void) const
 {
-    return (m_name);
+    return (std::string(m_name));
 }
 
 } // namespace nts
@@ -7,11 +7,13 @@
 // Dependencies
 ///////////////////////////////////////////////////////////////////////////////
 #include "Tristate.hpp"
+#include "Tristate64.hpp"
 #include "IComponent.hpp"
 #include <list>
 #include <memory>
 #include <vector>
 #include <string>
+#include <limits>
 
 ///////////////////////////////////////////////////////////////////////////////
 // Namespace nts
@@ -46,14 +48,25 @@ public:
         ELECTRICAL
     };
 
+    ///////////////////////////////////////////////////////////////////////////
+    // Stamp of a pin whose state was never latched
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr size_t NEVER = std::numeric_limits<size_t>::max();
+
 private:
     ///////////////////////////////////////////////////////////////////////////
     // Private properties
     ///////////////////////////////////////////////////////////////////////////
-    std::vector<Link> m_links;  //<!
+    std::pmr::vector<Link> m_links; //<! In the current arena
     Tristate m_state;           //<!
     Type m_type;                //<!
-    std::string m_name;         //<!
+    std::pmr::string m_name;    //<! In the current arena
+    size_t m_stamp;             //<! Epoch at which m_state was latched
+    Tristate m_memo;            //<! Last computed value
+    size_t m_sweep;             //<! Sweep at which m_memo was computed
+    Tristate64 m_pattern;       //<! Last computed bit-parallel value
+    size_t m_patternSweep;      //<! Sweep at which m_pattern was computed
+    size_t m_busy;              //<! Sweep of the read computing this pin
 
 public:
     ///////////////////////////////////////////////////////////////////////////
@@ -73,6 +86,98 @@ public:
     ///////////////////////////////////////////////////////////////////////////
     void setState(Tristate state);
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Store a state and mark it as valid for the given epoch
+    ///
+    /// \param state
+    /// \param epoch
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void setState(Tristate state, size_t epoch);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Check if the stored state was latched during the given epoch
+    ///
+    /// \param epoch
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    bool isFresh(size_t epoch) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Remember a computed value for the rest of the given sweep
+    ///
+    /// \param state
+    /// \param sweep
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void memoize(Tristate state, size_t sweep);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Check if a value was memoized during the given sweep
+    ///
+    /// \param sweep
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    bool isMemoized(size_t sweep) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Tristate getMemo(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Remember a computed bit-parallel value for the given sweep
+    ///
+    /// \param pattern
+    /// \param sweep
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void memoizePattern(const Tristate64& pattern, size_t sweep);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Check if a bit-parallel value was memoized during the sweep
+    ///
+    /// \param sweep
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    bool isPatternMemoized(size_t sweep) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    const Tristate64& getPattern(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Mark the pin as being computed, to detect combinational loops
+    ///
+    /// A mark only holds for the sweep it was set in, so a read aborted by an
+    /// exception cannot leave the pin stuck.
+    ///
+    /// \param sweep
+    ///
+    /// \return False if the pin was already being computed in this sweep
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    bool enter(size_t sweep);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void leave(void);
+
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
     ///
@@ -105,7 +210,7 @@ public:
     /// \return
     ///
     ///////////////////////////////////////////////////////////////////////////
-    const std::vector<Link>& getLinks(void) const;
+    const std::pmr::vector<Link>& getLinks(void) const;
 
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
@@ -3,6 +3,7 @@
 ///////////////////////////////////////////////////////////////////////////////
 #include "Counter.hpp"
 #include "Errors/OutOfRangePinException.hpp"
+#include "Snapshot.hpp"
 
 ///////////////////////////////////////////////////////////////////////////////
 // Namespace nts::Sequencials
@@ -44,19 +45,38 @@ void Counter::simulate(size_t tick)
         return;
     AComponent::simulate(tick);
 
-    Tristate clock = getInputState(0);
-    Tristate reset = getInputState(1);
+    count(getInputState(0), getInputState(1));
 
+    propagateOutput(2, compute(2));
+    propagateOutput(3, compute(3));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Counter::count(Tristate clock, Tristate reset)
+{
     if (reset == Tristate::True) {
-        m_count = 0;
+        store(m_count, 0);
     } else if (m_lastClock == Tristate::False && clock == Tristate::True) {
-        m_count = (m_count + 1) % 10;
+        store(m_count, (m_count + 1) % 10);
     }
 
-    m_lastClock = clock;
+    store(m_lastClock, clock);
+}
 
-    propagateOutput(2, compute(2));
-    propagateOutput(3, compute(3));
+///////////////////////////////////////////////////////////////////////////////
+void Counter::saveState(Snapshot& snapshot) const
+{
+    AComponent::saveState(snapshot);
+    snapshot.write(m_count);
+    snapshot.write(m_lastClock);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Counter::loadState(Snapshot& snapshot)
+{
+    AComponent::loadState(snapshot);
+    m_count = snapshot.read<size_t>();
+    m_lastClock = snapshot.read<Tristate>();
 }
 
 } // namespace nts::Sequencials
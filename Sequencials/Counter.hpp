@@ -50,6 +50,30 @@ public:
     /// \return Tristate logic value
     ///////////////////////////////////////////////////////////////////////////
     Tristate compute(size_t pin) override;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Apply one tick of the given input values to the count
+    ///
+    /// \param clock Counts on its rising edge
+    /// \param reset
+    ///////////////////////////////////////////////////////////////////////////
+    void count(Tristate clock, Tristate reset);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param snapshot
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void saveState(Snapshot& snapshot) const override;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param snapshot
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void loadState(Snapshot& snapshot) override;
 };
 
 } // namespace nts::Sequencials
@@ -3,6 +3,7 @@
 ///////////////////////////////////////////////////////////////////////////////
 #include "FlipFlop.hpp"
 #include "Errors/OutOfRangePinException.hpp"
+#include "Snapshot.hpp"
 
 ///////////////////////////////////////////////////////////////////////////////
 // Namespace nts::Sequencials
@@ -44,31 +45,60 @@ void FlipFlop::simulate(size_t tick)
         return;
     AComponent::simulate(tick);
 
-    Tristate clock  = getInputState(0);
-    Tristate data   = getInputState(1);
-    Tristate set    = getInputState(2);
-    Tristate reset  = getInputState(3);
+    latch(
+        getInputState(0),
+        getInputState(1),
+        getInputState(2),
+        getInputState(3)
+    );
 
+    propagateOutput(4, m_q1state);
+    propagateOutput(5, m_q2state);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void FlipFlop::latch(
+    Tristate clock,
+    Tristate data,
+    Tristate set,
+    Tristate reset
+)
+{
     if (reset && set) {
-        m_q1state = Tristate::True;
-        m_q2state = Tristate::True;
+        store(m_q1state, Tristate::True);
+        store(m_q2state, Tristate::True);
     } else if (reset == Tristate::True) {
-        m_q1state = Tristate::False;
-        m_q2state = Tristate::True;
+        store(m_q1state, Tristate::False);
+        store(m_q2state, Tristate::True);
     } else if (set == Tristate::True) {
-        m_q1state = Tristate::True;
-        m_q2state = Tristate::False;
+        store(m_q1state, Tristate::True);
+        store(m_q2state, Tristate::False);
     } else {
         if (m_lastClock == Tristate::False && clock == Tristate::True) {
-            m_q1state = data;
-            m_q2state = ~data;
+            store(m_q1state, data);
+            store(m_q2state, ~data);
         }
     }
 
-    m_lastClock = clock;
+    store(m_lastClock, clock);
+}
 
-    propagateOutput(4, m_q1state);
-    propagateOutput(5, m_q2state);
+///////////////////////////////////////////////////////////////////////////////
+void FlipFlop::saveState(Snapshot& snapshot) const
+{
+    AComponent::saveState(snapshot);
+    snapshot.write(m_lastClock);
+    snapshot.write(m_q1state);
+    snapshot.write(m_q2state);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void FlipFlop::loadState(Snapshot& snapshot)
+{
+    AComponent::loadState(snapshot);
+    m_lastClock = snapshot.read<Tristate>();
+    m_q1state = snapshot.read<Tristate>();
+    m_q2state = snapshot.read<Tristate>();
 }
 
 } // namespace nts::Sequencials
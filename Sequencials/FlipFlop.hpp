@@ -59,6 +59,33 @@ public:
     ///
     ///////////////////////////////////////////////////////////////////////////
     Tristate compute(size_t pin) override;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Apply one tick of the given input values to the latch
+    ///
+    /// \param clock
+    /// \param data
+    /// \param set
+    /// \param reset
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void latch(Tristate clock, Tristate data, Tristate set, Tristate reset);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param snapshot
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void saveState(Snapshot& snapshot) const override;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param snapshot
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void loadState(Snapshot& snapshot) override;
 };
 
 } // namespace nts::Sequencials
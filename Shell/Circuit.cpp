@@ -2,17 +2,35 @@
 // Dependencies
 ///////////////////////////////////////////////////////////////////////////////
 #include "Circuit.hpp"
+#include "Snapshot.hpp"
 #include "Errors/ComponentException.hpp"
 #include "Specials/Clock.hpp"
 #include "Specials/Input.hpp"
 #include "Specials/Output.hpp"
+#include "TraceWriter.hpp"
+#include "VcdWriter.hpp"
+#include "Engines/Bytecode.hpp"
+#include "Engines/Codegen.hpp"
+#include "Engines/Interpreted.hpp"
+#include "Engines/Levelized.hpp"
+#include "Engines/Optimizer.hpp"
+#include "Engines/EventDriven.hpp"
+#include "Engines/WorkStealing.hpp"
 #include <algorithm>
+#include <charconv>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <limits>
+#include <random>
+#include <stdexcept>
 #include <iostream>
 #include <unordered_set>
 #include <queue>
 #include <set>
 #include <map>
 #include <vector>
+#include <unistd.h>
 #ifdef NTS_BONUS
 #include <imgui_stdlib.h>
 #endif
@@ -23,12 +41,69 @@
 namespace nts
 {
 
+///////////////////////////////////////////////////////////////////////////////
+static const std::map<
+    std::string,
+    std::function<Circuit::Engine(void)>
+> RegisteredEngines = {
+    {"interpreted", [] { return std::make_unique<Engines::Interpreted>(); }},
+    {"levelized", [] { return std::make_unique<Engines::Levelized>(); }},
+    {"event", [] { return std::make_unique<Engines::EventDriven>(); }},
+    {"stealing", [] { return std::make_unique<Engines::WorkStealing>(); }},
+    {"bytecode", [] { return std::make_unique<Engines::Bytecode>(); }}
+};
+
+///////////////////////////////////////////////////////////////////////////////
+static constexpr uint64_t STATE_MAGIC = 0x455441545353544E; // "NTSSTATE"
+static constexpr uint32_t STATE_VERSION = 1;
+
+///////////////////////////////////////////////////////////////////////////////
+template<typename T>
+static void insert(
+    Circuit::Registry<T>& registry,
+    const std::string& name,
+    T* component
+)
+{
+    auto it = std::lower_bound(registry.begin(), registry.end(), name,
+        [](const auto& entry, const std::string& key) {
+            return (entry.first < key);
+        });
+    registry.insert(it, {name, component});
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template<typename T>
+static T* find(const Circuit::Registry<T>& registry, const std::string& name)
+{
+    auto it = std::lower_bound(registry.begin(), registry.end(), name,
+        [](const auto& entry, const std::string& key) {
+            return (entry.first < key);
+        });
+    if (it == registry.end() || it->first != name)
+        return (nullptr);
+    return (it->second);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Circuit::Circuit(void)
+    : m_engine(std::make_unique<Engines::Interpreted>())
+    , m_engineName("interpreted")
+    , m_output(&std::cout)
+    , m_interactive(isatty(STDOUT_FILENO))
+{}
+
 ///////////////////////////////////////////////////////////////////////////////
 void Circuit::addComponent(const std::string& type, const std::string& name)
 {
     if (m_components.find(name) != m_components.end())
         throw ComponentException("Component already exists: " + name);
+    Arena::Scope scope(m_arena);
     m_components[name] = m_factory.createComponent(type, name);
+    m_components[name]->setContext(&m_context);
+    registerComponent(name, m_components[name].get());
+    m_chipsets.push_back({type, name});
+    decompile();
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -43,26 +118,425 @@ void Circuit::setLink(
     Component c2 = getComponent(component2);
     c1->setLink(pin1, c2, pin2);
     c2->setLink(pin2, c1, pin1);
+    m_links.push_back({component1, pin1, component2, pin2});
+    decompile();
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void Circuit::simulate(void)
+void Circuit::setEngine(const std::string& name)
+{
+    auto it = RegisteredEngines.find(name);
+    if (it == RegisteredEngines.end())
+        throw std::runtime_error("Unknown engine: " + name);
+    Engine engine = it->second();
+    engine->setThreads(m_threads);
+    m_engine = std::move(engine);
+    m_engineName = name;
+    m_compiled = false;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Circuit::setThreads(size_t count)
+{
+    m_engine->setThreads(count);
+    m_threads = count;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Circuit::cloneInto(Circuit& target) const
+{
+    if (!target.m_components.empty())
+        throw std::runtime_error("Cannot clone into a non-empty circuit");
+    target.setEngine(m_engineName);
+    target.setThreads(m_threads);
+    target.setCompact(m_compact);
+    target.rebuild(m_chipsets, m_links);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Circuit::rebuild(
+    const std::vector<ChipsetDeclaration>& chipsets,
+    const std::vector<LinkDeclaration>& links
+)
+{
+    m_trace.reset();
+    m_components.clear();
+    m_arena.release();
+    m_chipsets.clear();
+    m_links.clear();
+    m_inputs.clear();
+    m_clocks.clear();
+    m_outputs.clear();
+    m_sources.clear();
+    decompile();
+    for (const ChipsetDeclaration& chipset : chipsets)
+        addComponent(chipset.type, chipset.name);
+    for (const LinkDeclaration& link : links)
+        setLink(link.component1, link.pin1, link.component2, link.pin2);
+    compile();
+    if (m_history)
+        m_history->reset(m_components, m_tick);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Circuit::setOutput(std::ostream& output)
 {
+    m_output = &output;
+    m_interactive = (&output == &std::cout && isatty(STDOUT_FILENO));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Circuit::trace(
+    const std::string& filename,
+    const std::vector<std::string>& signals
+)
+{
+    std::vector<std::string> names = signals;
+    std::vector<ITraceWriter::Signal> traced;
+
+    if (names.empty()) {
+        for (const auto& [name, component] : m_sources)
+            names.push_back(name);
+        for (const auto& [name, component] : m_outputs)
+            names.push_back(name);
+    }
+    for (const std::string& name : names) {
+        size_t colon = name.find(':');
+        size_t pin = 1;
+
+        if (colon != std::string::npos) {
+            try {
+                pin = std::stoul(name.substr(colon + 1));
+            } catch (const std::exception&) {
+                pin = 0;
+            }
+        }
+        Component component = getComponent(name.substr(0, colon));
+        if (pin == 0 || pin > component->getPins().size())
+            throw ComponentException("Invalid pin for trace: " + name);
+        traced.push_back({name, component.get(), pin - 1});
+    }
+    m_trace.reset();
+    if (filename.ends_with(".vcd"))
+        m_trace = std::make_unique<VcdWriter>(filename, std::move(traced));
+    else
+        m_trace = std::make_unique<TraceWriter>(filename, std::move(traced));
+    m_trace->sample(m_tick);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Circuit::untrace(void)
+{
+    m_trace.reset();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Circuit::saveState(Snapshot& snapshot) const
+{
+    std::vector<std::string> types = getTypes();
+    size_t i = 0;
+
+    snapshot.write(m_tick);
+    snapshot.write(static_cast<uint32_t>(m_pendingInputs.size()));
     for (const auto& [name, value] : m_pendingInputs) {
-        Component component = getComponent(name);
+        snapshot.write(name);
+        snapshot.write(value);
+    }
+    snapshot.write(static_cast<uint32_t>(m_components.size()));
+    for (const auto& [name, component] : m_components) {
+        snapshot.write(types[i++]);
+        snapshot.write(name);
+        component->saveState(snapshot);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Circuit::loadState(Snapshot& snapshot)
+{
+    Snapshot backup;
+    std::vector<std::string> types = getTypes();
+    size_t i = 0;
+
+    // Traces only go forward in time
+    if (m_trace)
+        throw std::runtime_error("Cannot load a state while tracing");
+    saveState(backup);
+    try {
+        m_tick = snapshot.read<size_t>();
+        m_pendingInputs.clear();
+        for (uint32_t count = snapshot.read<uint32_t>(); count > 0; count--) {
+            std::string name = snapshot.read<std::string>();
+            m_pendingInputs[name] = snapshot.read<Tristate>();
+        }
+        if (snapshot.read<uint32_t>() != m_components.size())
+            throw std::runtime_error("State does not match the circuit");
+        for (const auto& [name, component] : m_components) {
+            if (snapshot.read<std::string>() != types[i++]
+                || snapshot.read<std::string>() != name)
+                throw std::runtime_error("State does not match the circuit");
+            component->loadState(snapshot);
+        }
+        if (!snapshot.isConsumed())
+            throw std::runtime_error("State does not match the circuit");
+    } catch (...) {
+        Snapshot restore(backup.getBytes());
+        loadState(restore);
+        throw;
+    }
+    decompile();    // Engines cache values derived from the old state
+    m_context.invalidate();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Circuit::saveState(const std::string& filename) const
+{
+    Snapshot snapshot;
+    std::ofstream file(filename, std::ios::binary);
+
+    if (!file)
+        throw std::runtime_error("Cannot create " + filename);
+    snapshot.write(STATE_MAGIC);
+    snapshot.write(STATE_VERSION);
+    saveState(snapshot);
+    const std::string& bytes = snapshot.getBytes();
+    if (!file.write(bytes.data(), bytes.size()))
+        throw std::runtime_error("Cannot write " + filename);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Circuit::loadState(const std::string& filename)
+{
+    std::ifstream file(filename, std::ios::binary | std::ios::ate);
+
+    if (!file)
+        throw std::runtime_error("Cannot open " + filename);
+    std::string bytes(static_cast<size_t>(file.tellg()), '\0');
+    file.seekg(0);
+    if (!file.read(bytes.data(), bytes.size()))
+        throw std::runtime_error("Cannot read " + filename);
+
+    Snapshot snapshot(std::move(bytes));
+    if (snapshot.read<uint64_t>() != STATE_MAGIC
+        || snapshot.read<uint32_t>() != STATE_VERSION)
+        throw std::runtime_error("Not a state file: " + filename);
+    loadState(snapshot);
+    if (m_history)
+        m_history->reset(m_components, m_tick);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Circuit::setHistory(size_t budget)
+{
+    m_history.reset();
+    if (budget == 0)
+        return;
+    m_history = std::make_unique<History>(budget);
+    m_history->reset(m_components, m_tick);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Circuit::rewind(size_t tick)
+{
+    if (!m_history)
+        throw std::runtime_error("No history is recorded");
+    if (m_trace)
+        throw std::runtime_error("Cannot rewind while tracing");
+    m_history->restore(m_components, tick);
+    m_tick = tick;
+    m_pendingInputs.clear();
+    decompile();
+    m_context.invalidate();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+const History* Circuit::getHistory(void) const
+{
+    return (m_history.get());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Circuit::setCompact(bool compact)
+{
+    m_compact = compact;
+    m_header = true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Circuit::emitCpp(std::ostream& output)
+{
+    if (!m_compiled)
+        compile();
+    Engines::Codegen(m_context.getNets(), getTypes()).emit(output);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Engines::Optimizer::Report Circuit::optimize(void)
+{
+    std::vector<std::string> names;
+    std::map<std::pair<std::string, size_t>, size_t> firstLinks;
+    std::vector<LinkDeclaration> links(m_links);
+    std::vector<ChipsetDeclaration> chipsets;
+    std::set<std::string> constants;
+
+    if (!m_compiled)
+        compile();
+    Engines::Optimizer optimizer(m_context.getNets(), getTypes());
+    Engines::Optimizer::Report report = optimizer.run();
+
+    for (const auto& [name, component] : m_components)
+        names.push_back(name);
+    for (size_t i = 0; i < links.size(); i++) {
+        firstLinks.insert({{links[i].component1, links[i].pin1}, i});
+        firstLinks.insert({{links[i].component2, links[i].pin2}, i});
+    }
+
+    // A pin reads the first link declared on it, so redirecting that
+    // declaration is enough to change its driver
+    for (const auto& rewire : optimizer.getRewires()) {
+        const std::string& name = names[rewire.component];
+        LinkDeclaration& link = links[firstLinks.at({name, rewire.pin})];
+        std::string source = "#false";
+        size_t pin = 0;
+
+        if (rewire.source.kind == Engines::Optimizer::Signal::Kind::WIRE) {
+            source = names[rewire.source.wire.component];
+            pin = rewire.source.wire.pin;
+        } else if (rewire.source.value == Tristate::True)
+            source = "#true";
+        if (source[0] == '#')
+            constants.insert(source);
+        if (link.component1 == name && link.pin1 == rewire.pin)
+            link = {name, rewire.pin, source, pin};
+        else
+            link = {source, pin, name, rewire.pin};
+    }
+
+    std::map<std::string, uint32_t> indices;
+    for (uint32_t i = 0; i < names.size(); i++)
+        indices[names[i]] = i;
+    auto kept = [&](const std::string& name, size_t pin) {
+        auto it = indices.find(name);
+        return (it == indices.end() || (!optimizer.isRemoved(it->second)
+            && optimizer.isLive(it->second, pin)));
+    };
+    std::erase_if(links, [&](const LinkDeclaration& link) {
+        return (!kept(link.component1, link.pin1)
+            || !kept(link.component2, link.pin2));
+    });
+    for (const ChipsetDeclaration& chipset : m_chipsets) {
+        if (!optimizer.isRemoved(indices[chipset.name]))
+            chipsets.push_back(chipset);
+    }
+    for (const std::string& name : constants)
+        chipsets.push_back({name.substr(1), name});
+
+    rebuild(chipsets, links);
+    return (report);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Circuit::registerComponent(const std::string& name, IComponent* component)
+{
+    if (auto input = dynamic_cast<Specials::Input*>(component)) {
+        insert(m_inputs, name, input);
+        insert(m_sources, name, component);
+    } else if (auto clock = dynamic_cast<Specials::Clock*>(component)) {
+        insert(m_clocks, name, clock);
+        insert(m_sources, name, component);
+    } else if (auto output = dynamic_cast<Specials::Output*>(component)) {
+        insert(m_outputs, name, output);
+        m_header = true;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Circuit::unregisterComponent(const std::string& name)
+{
+    auto matches = [&name](const auto& entry) {
+        return (entry.first == name);
+    };
+
+    m_trace.reset();    // It may hold pins of the component
+
+    std::erase_if(m_inputs, matches);
+    std::erase_if(m_clocks, matches);
+    if (std::erase_if(m_outputs, matches))
+        m_header = true;
+    std::erase_if(m_sources, matches);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector<std::string> Circuit::getTypes(void) const
+{
+    std::map<std::string, std::string> types;
+    std::vector<std::string> ordered;
+
+    for (const ChipsetDeclaration& chipset : m_chipsets)
+        types[chipset.name] = chipset.type;
+    for (const auto& [name, component] : m_components)
+        ordered.push_back(types[name]);
+    return (ordered);
+}
 
-        auto input = std::dynamic_pointer_cast<Specials::Input>(component);
-        auto clock = std::dynamic_pointer_cast<Specials::Clock>(component);
+///////////////////////////////////////////////////////////////////////////////
+void Circuit::compile(void)
+{
+    m_context.getNets().build(m_components);
+    m_context.setLatching(false);
+    m_engine->compile(m_components, m_context);
+    m_compiled = true;
+}
 
-        if (input)      input->setValue(value);
-        else if (clock) clock->setValue(value);
+///////////////////////////////////////////////////////////////////////////////
+void Circuit::decompile(void)
+{
+    m_context.getNets().clear();
+    m_compiled = false;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Circuit::simulate(void)
+{
+    for (const auto& [name, value] : m_pendingInputs) {
+        if (auto input = find(m_inputs, name))
+            input->setValue(value);
+        else if (auto clock = find(m_clocks, name))
+            clock->setValue(value);
     }
     m_pendingInputs.clear();
 
     m_tick++;
 
-    for (auto& [name, component] : m_components)
-        component->simulate(m_tick);
+    if (!m_compiled)
+        compile();
+    m_engine->simulate(m_tick);
+    if (m_trace)
+        m_trace->sample(m_tick);
+    if (m_history)
+        m_history->record(m_components, m_tick);
+    m_context.invalidate();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool Circuit::canSkip(void) const
+{
+    if (m_trace)
+        return (false);
+    for (const auto& [name, component] : m_components) {
+        if (component->hasSideEffects())
+            return (false);
+    }
+    return (true);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Circuit::skip(size_t ticks)
+{
+    if (ticks == 0)
+        return;
+    m_tick += ticks;
+    if (m_history)
+        m_history->reset(m_components, m_tick);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -77,59 +551,173 @@ Circuit::Component Circuit::getComponent(const std::string& name)
 ///////////////////////////////////////////////////////////////////////////////
 void Circuit::setValue(const std::string& name, Tristate value)
 {
-    Component component = getComponent(name);
+    if (!find(m_sources, name)) {
+        getComponent(name);     // Report unknown names as such
+        throw ComponentException("Component is not an input or clock: "
+            + name);
+    }
+    m_pendingInputs[name] = value;
+}
 
-    auto input = std::dynamic_pointer_cast<Specials::Input>(component);
-    auto clock = std::dynamic_pointer_cast<Specials::Clock>(component);
+///////////////////////////////////////////////////////////////////////////////
+static void append(std::string& buffer, size_t value)
+{
+    char digits[std::numeric_limits<size_t>::digits10 + 1];
+    auto result = std::to_chars(digits, digits + sizeof(digits), value);
 
-    if (input || clock) {
-        m_pendingInputs[name] = value;
-        return;
-    }
+    buffer.append(digits, result.ptr);
+}
 
-    throw ComponentException("Component is not an input or clock: " + name);
+///////////////////////////////////////////////////////////////////////////////
+static void append(std::string& buffer, Tristate value)
+{
+    switch (value) {
+        case Tristate::True:    buffer += '1'; break;
+        case Tristate::False:   buffer += '0'; break;
+        default:                buffer += 'U'; break;
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void Circuit::displayInputs(void) const
+template<typename T>
+static void appendValues(std::string& buffer, const Circuit::Registry<T>& list)
 {
-    std::vector<std::string> inputs;
-    for (const auto& [name, component] : m_components) {
-        if (
-            std::dynamic_pointer_cast<Specials::Input>(component) ||
-            std::dynamic_pointer_cast<Specials::Clock>(component)
-        ) inputs.push_back(name);
+    for (const auto& [name, component] : list) {
+        buffer += "  ";
+        buffer += name;
+        buffer += ": ";
+        append(buffer, component->compute(0));
+        buffer += '\n';
     }
-    std::sort(inputs.begin(), inputs.end());
+}
 
-    std::cout << "input(s):" << std::endl;
-    for (const auto& name : inputs)
-        std::cout << "  " << name << ": "
-                  << m_components.at(name)->compute(0) << std::endl;
+///////////////////////////////////////////////////////////////////////////////
+void Circuit::formatVerbose(void) const
+{
+    m_buffer += "tick: ";
+    append(m_buffer, m_tick);
+    m_buffer += "\ninput(s):\n";
+    appendValues(m_buffer, m_sources);
+    m_buffer += "output(s):\n";
+    appendValues(m_buffer, m_outputs);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void Circuit::displayOutputs(void) const
+void Circuit::formatCompact(void) const
 {
-    std::vector<std::string> outputs;
-    for (const auto& [name, component] : m_components) {
-        if (std::dynamic_pointer_cast<Specials::Output>(component))
-            outputs.push_back(name);
+    if (m_header) {
+        m_buffer += "tick";
+        for (const auto& [name, component] : m_outputs) {
+            m_buffer += ' ';
+            m_buffer += name;
+        }
+        m_buffer += '\n';
+        m_header = false;
     }
-    std::sort(outputs.begin(), outputs.end());
-
-    std::cout << "output(s):" << std::endl;
-    for (const auto& name : outputs)
-        std::cout << "  " << name << ": "
-                  << m_components.at(name)->compute(0) << std::endl;
+    append(m_buffer, m_tick);
+    for (const auto& [name, component] : m_outputs) {
+        m_buffer += ' ';
+        append(m_buffer, component->compute(0));
+    }
+    m_buffer += '\n';
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 void Circuit::display(void) const
 {
-    std::cout << "tick: " << m_tick << std::endl;
-    displayInputs();
-    displayOutputs();
+    m_buffer.clear();
+    if (m_compact)
+        formatCompact();
+    else
+        formatVerbose();
+    m_output->write(m_buffer.data(), m_buffer.size());
+    if (m_interactive)
+        m_output->flush();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Circuit::PatternMap Circuit::evaluatePatterns(const PatternMap& patterns)
+{
+    if (!m_compiled)
+        compile();
+
+    auto pattern = [&patterns](const std::string& name) {
+        auto it = patterns.find(name);
+        return (it == patterns.end() ? Tristate64() : it->second);
+    };
+
+    for (const auto& [name, input] : m_inputs)
+        input->setPattern(pattern(name));
+    for (const auto& [name, clock] : m_clocks)
+        clock->setPattern(pattern(name));
+    m_context.invalidate();
+
+    PatternMap outputs;
+    for (const auto& [name, output] : m_outputs)
+        outputs[name] = output->compute64(0);
+    return (outputs);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Circuit::displayPatterns(size_t count)
+{
+    static const uint64_t LANE_MASKS[] = {
+        0xAAAAAAAAAAAAAAAA, 0xCCCCCCCCCCCCCCCC, 0xF0F0F0F0F0F0F0F0,
+        0xFF00FF00FF00FF00, 0xFFFF0000FFFF0000, 0xFFFFFFFF00000000
+    };
+    std::vector<std::string> inputs;
+    std::vector<std::string> outputs;
+
+    for (const auto& [name, component] : m_sources)
+        inputs.push_back(name);
+    for (const auto& [name, component] : m_outputs)
+        outputs.push_back(name);
+
+    bool exhaustive = (count == 0);
+    if (exhaustive) {
+        if (inputs.size() > 24)
+            throw std::runtime_error("Too many inputs, give a vector count");
+        count = size_t(1) << inputs.size();
+    }
+
+    std::mt19937_64 random(0);
+    for (size_t base = 0; base < count; base += Tristate64::LANES) {
+        PatternMap patterns;
+
+        for (size_t i = 0; i < inputs.size(); i++) {
+            size_t shift = inputs.size() - 1 - i;
+            uint64_t bits = 0;
+
+            if (!exhaustive)
+                bits = random();
+            else if (shift < 6)
+                bits = LANE_MASKS[shift];
+            else if ((base >> shift) & 1)
+                bits = ~uint64_t(0);
+            patterns[inputs[i]] = Tristate64(bits, ~uint64_t(0));
+        }
+
+        PatternMap results = evaluatePatterns(patterns);
+        if (base == 0) {
+            for (const auto& name : inputs)
+                *m_output << name << " ";
+            *m_output << "|";
+            for (const auto& name : outputs)
+                *m_output << " " << name;
+            *m_output << std::endl;
+        }
+        size_t lanes = std::min(Tristate64::LANES, count - base);
+        for (size_t lane = 0; lane < lanes; lane++) {
+            for (const auto& name : inputs)
+                *m_output << std::setw(name.size())
+                          << patterns[name].get(lane) << " ";
+            *m_output << "|";
+            for (const auto& name : outputs)
+                *m_output << " " << std::setw(name.size())
+                          << results[name].get(lane);
+            *m_output << std::endl;
+        }
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -138,16 +726,45 @@ const Circuit::ComponentMap& Circuit::getComponents(void) const
     return (m_components);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+size_t Circuit::getTick(void) const
+{
+    return (m_tick);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+size_t Circuit::getEvaluations(void) const
+{
+    return (m_engine->getEvaluations());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Circuit::readOutputs(std::vector<Tristate>& values) const
+{
+    values.resize(m_outputs.size());
+    for (size_t i = 0; i < m_outputs.size(); i++)
+        values[i] = m_outputs[i].second->compute(0);
+}
+
 #ifdef NTS_BONUS
 
 ///////////////////////////////////////////////////////////////////////////////
 void Circuit::clear(void)
 {
+    m_trace.reset();
     m_components.clear();
+    m_arena.release();
+    m_chipsets.clear();
+    m_links.clear();
+    m_inputs.clear();
+    m_clocks.clear();
+    m_outputs.clear();
+    m_sources.clear();
     m_gotoTick = 1;
     m_tick = 0;
     m_pendingInputs.clear();
     m_initialized = false;
+    decompile();
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -556,7 +1173,15 @@ void Circuit::draw(void)
                 }
             }
 
+            unregisterComponent(name);
             m_components.erase(name);
+            std::erase_if(m_chipsets, [&name](const auto& chipset) {
+                return (chipset.name == name);
+            });
+            std::erase_if(m_links, [&name](const LinkDeclaration& link) {
+                return (link.component1 == name || link.component2 == name);
+            });
+            decompile();
         }
     }
 }
@@ -6,11 +6,29 @@
 ///////////////////////////////////////////////////////////////////////////////
 // Dependencies
 ///////////////////////////////////////////////////////////////////////////////
+#include "Arena.hpp"
 #include "IComponent.hpp"
 #include "Factory.hpp"
+#include "Engines/IEngine.hpp"
+#include "Engines/Optimizer.hpp"
+#include "ITraceWriter.hpp"
+#include "History.hpp"
+#include <iostream>
 #include <memory>
 #include <map>
+#include <string>
 #include <unordered_map>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// Forward declarations
+///////////////////////////////////////////////////////////////////////////////
+namespace nts::Specials
+{
+    class Input;
+    class Clock;
+    class Output;
+}
 
 ///////////////////////////////////////////////////////////////////////////////
 // Namespace nts
@@ -29,17 +47,63 @@ public:
     // Type alias
     ///////////////////////////////////////////////////////////////////////////
     using Component = std::shared_ptr<IComponent>;
-    using ComponentMap = std::map<std::string, Component>;
+    using ComponentMap = Engines::IEngine::ComponentMap;
     using PendingMap = std::map<std::string, Tristate>;
+    using PatternMap = std::map<std::string, Tristate64>;
+    using Engine = std::unique_ptr<Engines::IEngine>;
+    template<typename T>
+    using Registry = std::vector<std::pair<std::string, T*>>;
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief A component as it was declared
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct ChipsetDeclaration
+    {
+        std::string type;           //<!
+        std::string name;           //<!
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief A link as it was declared
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct LinkDeclaration
+    {
+        std::string component1;     //<!
+        size_t pin1;                //<!
+        std::string component2;     //<!
+        size_t pin2;                //<!
+    };
 
 private:
     ///////////////////////////////////////////////////////////////////////////
     // Private properties
     ///////////////////////////////////////////////////////////////////////////
+    Arena m_arena;                  //<! Outlives every component
     Factory m_factory;              //<!
     PendingMap m_pendingInputs;     //<!
     ComponentMap m_components;      //<!
     size_t m_tick{0};               //<!
+    Engine m_engine;                //<!
+    Engines::Context m_context;     //<!
+    bool m_compiled{false};         //<!
+    size_t m_threads{1};            //<!
+    std::string m_engineName;       //<!
+    std::vector<ChipsetDeclaration> m_chipsets; //<! In declaration order
+    std::vector<LinkDeclaration> m_links;       //<! In declaration order
+    Registry<Specials::Input> m_inputs;         //<! Sorted by name
+    Registry<Specials::Clock> m_clocks;         //<! Sorted by name
+    Registry<Specials::Output> m_outputs;       //<! Sorted by name
+    Registry<IComponent> m_sources;             //<! Inputs and clocks
+    std::ostream* m_output;         //<!
+    bool m_interactive;             //<! Flush after every display
+    bool m_compact{false};          //<! One line per tick
+    mutable bool m_header{true};    //<! Compact header still to print
+    mutable std::string m_buffer;   //<! Reused by every display
+    std::unique_ptr<ITraceWriter> m_trace;  //<! Sampled after every tick
+    std::unique_ptr<History> m_history;     //<! Recorded after every tick
 #ifdef NTS_BONUS
     int m_gotoTick = 1;             //<!
     bool m_initialized = false;     //<!
@@ -61,16 +125,69 @@ private:
     Component getComponent(const std::string& name);
 
     ///////////////////////////////////////////////////////////////////////////
-    /// \brief
+    /// \brief Drop the compiled netlist after a topology change
     ///
     ///////////////////////////////////////////////////////////////////////////
-    void displayInputs(void) const;
+    void decompile(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief File a new component in the registry matching its type
+    ///
+    /// \param name
+    /// \param component
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void registerComponent(const std::string& name, IComponent* component);
 
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
     ///
+    /// \param name
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void unregisterComponent(const std::string& name);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the factory type of every component, in net table order
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    std::vector<std::string> getTypes(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Replace every component and link by fresh ones, then compile
+    ///
+    /// \param chipsets
+    /// \param links
+    ///
     ///////////////////////////////////////////////////////////////////////////
-    void displayOutputs(void) const;
+    void rebuild(
+        const std::vector<ChipsetDeclaration>& chipsets,
+        const std::vector<LinkDeclaration>& links
+    );
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Append the tick, inputs and outputs, one per line
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void formatVerbose(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Append the tick and every output on a single line
+    ///
+    /// A header naming the columns comes first, and again whenever the set
+    /// of outputs changes.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void formatCompact(void) const;
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Construct an empty circuit using the interpreted engine
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Circuit(void);
 
 public:
     ///////////////////////////////////////////////////////////////////////////
@@ -98,12 +215,202 @@ public:
         std::size_t pin2
     );
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Select the simulation engine by name
+    ///
+    /// \param name One of "interpreted", "levelized", "event" or "stealing"
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void setEngine(const std::string& name);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Set how many threads the engine may use, kept across engines
+    ///
+    /// \param count
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void setThreads(size_t count);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Rebuild this circuit into an empty one
+    ///
+    /// Components and links are created again in declaration order with the
+    /// same engine and thread count, so the copy starts from a fresh state
+    /// without going through the parser. Reading the source is thread-safe.
+    ///
+    /// \param target
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void cloneInto(Circuit& target) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Set the stream display commands write to, std::cout by default
+    ///
+    /// Display output is only flushed on every tick when it goes to a
+    /// terminal, otherwise the stream flushes as its buffer fills up.
+    ///
+    /// \param output
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void setOutput(std::ostream& output);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Switch display to one `<tick> <outputs>...` line per tick
+    ///
+    /// \param compact
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void setCompact(bool compact);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Start recording pin values, replacing any running trace
+    ///
+    /// Files ending in `.vcd` get a Value Change Dump, any other name the
+    /// binary format of TraceWriter.
+    /// A signal is either a component name, for its first pin, or
+    /// `<component>:<pin>` using the pin numbers of `.links:`. With no
+    /// signal, every input, clock and output is traced. The current values
+    /// are recorded right away, then after every tick. Loading a new netlist
+    /// stops the trace.
+    ///
+    /// \param filename
+    /// \param signals
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void trace(
+        const std::string& filename,
+        const std::vector<std::string>& signals
+    );
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Stop and close the running trace, if any
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void untrace(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Append the dynamic state of the circuit to a snapshot
+    ///
+    /// Covers the tick, the pending input values and, for every component,
+    /// its pins and internal state (latches, counters, registers, memory).
+    /// The netlist itself is not saved: a snapshot only fits a circuit
+    /// built from the same file.
+    ///
+    /// \param snapshot
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void saveState(Snapshot& snapshot) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Restore a state written by saveState
+    ///
+    /// The circuit is left unchanged if the snapshot does not match it, or
+    /// if a trace is running.
+    ///
+    /// \param snapshot
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void loadState(Snapshot& snapshot);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Write the dynamic state of the circuit to a file
+    ///
+    /// \param filename
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void saveState(const std::string& filename) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Restore a state file written by saveState
+    ///
+    /// \param filename
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void loadState(const std::string& filename);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Keep recent states so that the circuit can be rewound
+    ///
+    /// Recording starts from the current state, replacing any previous
+    /// history. Loading a state file or a new netlist starts it over.
+    ///
+    /// \param budget Bytes the history may use, 0 to stop recording
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void setHistory(size_t budget);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Go back, or forward again, to a tick kept in the history
+    ///
+    /// Pending input values are dropped. The ticks after the target stay
+    /// reachable until the next simulation overwrites them.
+    ///
+    /// \param tick
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void rewind(size_t tick);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the running history
+    ///
+    /// \return nullptr when no history is recorded
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    const History* getHistory(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Write a standalone C++ simulator of this circuit
+    ///
+    /// \param output
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void emitCpp(std::ostream& output);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Fold constants, collapse double inversions and drop dead logic
+    ///
+    /// Meant to run once after loading: the circuit is rebuilt from the
+    /// simplified declarations, so every component starts over. Constants
+    /// the circuit lacks are added as `#true` and `#false`, names the parser
+    /// can never produce.
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Engines::Optimizer::Report optimize(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Lower the current netlist for the selected engine
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void compile(void);
+
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
     ///
     ///////////////////////////////////////////////////////////////////////////
     void simulate(void);
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Tell if ticks can be skipped without it showing anywhere
+    ///
+    /// \return False while tracing, or if a component has side effects
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    bool canSkip(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Move the tick forward without simulating
+    ///
+    /// Only meant for whole periods of a circuit found to repeat its state:
+    /// the components are then already in the state the skipped ticks would
+    /// end on. The history starts over from the new tick.
+    ///
+    /// \param ticks
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void skip(size_t ticks);
+
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
     ///
@@ -114,11 +421,32 @@ public:
     void setValue(const std::string& name, Tristate value);
 
     ///////////////////////////////////////////////////////////////////////////
-    /// \brief
+    /// \brief Format the current state and write it in a single call
     ///
     ///////////////////////////////////////////////////////////////////////////
     void display(void) const;
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Evaluate the circuit for 64 input patterns in one pass
+    ///
+    /// Only components with a bit-parallel model (gates, QuadGate, 4069,
+    /// inputs, outputs and constants) are supported, anything else throws.
+    ///
+    /// \param patterns Lanes per input or clock, missing ones are Undefined
+    ///
+    /// \return Lanes per output
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    PatternMap evaluatePatterns(const PatternMap& patterns);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Print the outputs for a set of input vectors, 64 per pass
+    ///
+    /// \param count Number of random vectors, 0 for every combination
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void displayPatterns(size_t count);
+
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
     ///
@@ -127,6 +455,30 @@ public:
     ///////////////////////////////////////////////////////////////////////////
     const ComponentMap& getComponents(void) const;
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the number of simulated ticks
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    size_t getTick(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get how many component evaluations the engine ran so far
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    size_t getEvaluations(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Read every output, in name order
+    ///
+    /// \param values Resized to the number of outputs
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void readOutputs(std::vector<Tristate>& values) const;
+
 #ifdef NTS_BONUS
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
@@ -0,0 +1,42 @@
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "CycleDetector.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace nts
+///////////////////////////////////////////////////////////////////////////////
+namespace nts
+{
+
+///////////////////////////////////////////////////////////////////////////////
+CycleDetector::CycleDetector(size_t budget)
+    : m_budget(budget)
+{
+    m_scratch.setTimeless(0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+size_t CycleDetector::observe(const ComponentMap& components, size_t tick)
+{
+    if (isExhausted())
+        return (0);
+
+    m_scratch.clear();
+    for (const auto& [name, component] : components)
+        component->saveState(m_scratch);
+
+    auto [entry, inserted] = m_seen.try_emplace(m_scratch.getBytes(), tick);
+    if (!inserted)
+        return (tick - entry->second);
+    m_memory += sizeof(*entry) + entry->first.size();
+    return (0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool CycleDetector::isExhausted(void) const
+{
+    return (m_memory > m_budget);
+}
+
+} // namespace nts
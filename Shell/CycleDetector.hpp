@@ -0,0 +1,77 @@
+///////////////////////////////////////////////////////////////////////////////
+// Header guard
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Snapshot.hpp"
+#include "Engines/IEngine.hpp"
+#include <string>
+#include <unordered_map>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace nts
+///////////////////////////////////////////////////////////////////////////////
+namespace nts
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Spot the first state a circuit comes back to
+///
+/// Every observed state is kept whole, without the component ticks, in a
+/// hash table, so a match is exact. Once the table outgrows its budget,
+/// observing stops. Inputs must not change between observations: with the
+/// same state and the same inputs, a circuit then repeats the same ticks
+/// forever.
+///
+///////////////////////////////////////////////////////////////////////////////
+class CycleDetector
+{
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    // Type alias
+    ///////////////////////////////////////////////////////////////////////////
+    using ComponentMap = Engines::IEngine::ComponentMap;
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    // Private properties
+    ///////////////////////////////////////////////////////////////////////////
+    size_t m_budget;                                //<! In bytes
+    size_t m_memory{0};                             //<! Used by m_seen
+    std::unordered_map<std::string, size_t> m_seen; //<! State to tick
+    Snapshot m_scratch;                             //<! Timeless
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param budget Bytes the seen states may use
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    explicit CycleDetector(size_t budget = 64 << 20);
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Remember the state reached at a tick
+    ///
+    /// \param components
+    /// \param tick
+    ///
+    /// \return Ticks since the same state was last seen, 0 if it is new
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    size_t observe(const ComponentMap& components, size_t tick);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Tell if the budget is spent, later states are not looked at
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    bool isExhausted(void) const;
+};
+
+} // namespace nts
@@ -0,0 +1,98 @@
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Farm.hpp"
+#include "Parser.hpp"
+#include "Shell.hpp"
+#include "Engines/WorkerPool.hpp"
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <stdexcept>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace nts
+///////////////////////////////////////////////////////////////////////////////
+namespace nts
+{
+
+///////////////////////////////////////////////////////////////////////////////
+void Farm::setEngine(const std::string& name)
+{
+    m_prototype.setEngine(name);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Farm::setThreads(size_t count)
+{
+    m_prototype.setThreads(count);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Farm::setCompact(bool compact)
+{
+    m_prototype.setCompact(compact);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Farm::loadCircuit(const std::string& filename)
+{
+    Parser::parseCircuit(m_prototype, filename);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Engines::Optimizer::Report Farm::optimize(void)
+{
+    return (m_prototype.optimize());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+size_t Farm::run(const std::vector<std::string>& scripts, size_t workers)
+{
+    for (const auto& [name, component] : m_prototype.getComponents()) {
+        if (component->hasSideEffects())
+            throw std::runtime_error(
+                "Farm mode cannot run circuits with side effects: " + name);
+    }
+
+    if (scripts.empty())
+        return (0);
+
+    Engines::WorkerPool pool(std::clamp<size_t>(workers, 1, scripts.size()));
+    std::atomic<size_t> next{0};
+    std::atomic<size_t> failures{0};
+    std::mutex errors;
+
+    pool.run(pool.size(), [&](size_t) {
+        for (size_t i = next++; i < scripts.size(); i = next++) {
+            try {
+                runScript(scripts[i]);
+            } catch (const std::exception& e) {
+                std::lock_guard<std::mutex> lock(errors);
+                std::cerr << scripts[i] << ": " << e.what() << std::endl;
+                failures++;
+            }
+        }
+    });
+    return (failures);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Farm::runScript(const std::string& script) const
+{
+    std::ifstream input(script);
+    if (!input.is_open())
+        throw std::runtime_error("Cannot open script file");
+
+    std::ofstream output(script + ".out");
+    if (!output.is_open())
+        throw std::runtime_error("Cannot create " + script + ".out");
+
+    Shell shell(input, output, output);
+    shell.loadCircuit(m_prototype);
+    shell.run();
+}
+
+} // namespace nts
@@ -0,0 +1,103 @@
+///////////////////////////////////////////////////////////////////////////////
+// Header guard
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Circuit.hpp"
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace nts
+///////////////////////////////////////////////////////////////////////////////
+namespace nts
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Run many command scripts against copies of one circuit
+///
+/// The circuit file is parsed once into a prototype. Each script gets its
+/// own clone and its own shell, reading commands from the script and
+/// writing prompts, display output and errors to `<script>.out`, exactly
+/// what `nanotekspice circuit < script` would print. Scripts are handed
+/// out to a fixed set of threads as they free up.
+///
+///////////////////////////////////////////////////////////////////////////////
+class Farm
+{
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    // Private properties
+    ///////////////////////////////////////////////////////////////////////////
+    Circuit m_prototype;    //<!
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param name
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void setEngine(const std::string& name);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Set the thread count of every instance engine
+    ///
+    /// \param count
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void setThreads(size_t count);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Display one line per tick in every instance
+    ///
+    /// \param compact
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void setCompact(bool compact);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param filename
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void loadCircuit(const std::string& filename);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Simplify the prototype before it is cloned
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Engines::Optimizer::Report optimize(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Run every script on its own instance
+    ///
+    /// A script that cannot be run is reported on std::cerr and does not
+    /// stop the others. Circuits with side effects are refused, since their
+    /// instances would all write the same files.
+    ///
+    /// \param scripts
+    /// \param workers Threads running instances
+    ///
+    /// \return Number of scripts that failed
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    size_t run(const std::vector<std::string>& scripts, size_t workers);
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param script
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void runScript(const std::string& script) const;
+};
+
+} // namespace nts
@@ -0,0 +1,194 @@
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "History.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace nts
+///////////////////////////////////////////////////////////////////////////////
+namespace nts
+{
+
+///////////////////////////////////////////////////////////////////////////////
+static size_t cost(const std::string& bytes)
+{
+    return (sizeof(std::string) + bytes.size());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+History::History(size_t budget)
+    : m_budget(budget)
+{
+    m_scratch.setTimeless(0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void History::reset(const ComponentMap& components, size_t tick)
+{
+    m_segments.clear();
+    m_memory = 0;
+    capture(components);
+    m_state = m_scratch.getBytes();
+    m_tick = tick;
+    startSegment();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void History::record(const ComponentMap& components, size_t tick)
+{
+    if (m_segments.empty() || tick != m_tick + 1) {
+        reset(components, tick);
+        return;
+    }
+    truncate();
+    capture(components);
+
+    const std::string& state = m_scratch.getBytes();
+    if (state.size() != m_state.size()) {
+        reset(components, tick);
+        return;
+    }
+
+    Segment& segment = m_segments.back();
+    size_t keyframe = cost(segment.keyframe);
+    if (segment.deltas.size() >= KEYFRAME_TICKS
+        || segment.bytes - keyframe >= keyframe) {
+        m_state = state;
+        m_tick = tick;
+        startSegment();
+        return;
+    }
+
+    Snapshot delta;
+    for (size_t i = 0; i + 1 < m_offsets.size(); i++) {
+        size_t begin = m_offsets[i];
+        size_t size = m_offsets[i + 1] - begin;
+
+        if (std::memcmp(state.data() + begin, m_state.data() + begin,
+                size) == 0)
+            continue;
+        delta.write(static_cast<uint32_t>(begin));
+        delta.write(state.substr(begin, size));
+    }
+    m_state = state;
+    m_tick = tick;
+    segment.deltas.push_back(delta.getBytes());
+    segment.bytes += cost(segment.deltas.back());
+    m_memory += cost(segment.deltas.back());
+    evict();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void History::restore(const ComponentMap& components, size_t tick)
+{
+    if (m_segments.empty() || tick < getFirstTick() || tick > getLastTick())
+        throw std::runtime_error("Tick " + std::to_string(tick)
+            + " is not in the history");
+
+    auto segment = std::prev(std::upper_bound(
+        m_segments.begin(), m_segments.end(), tick,
+        [](size_t value, const Segment& entry) {
+            return (value < entry.tick);
+        }));
+
+    m_state = segment->keyframe;
+    for (size_t k = 0; k < tick - segment->tick; k++) {
+        Snapshot delta(segment->deltas[k]);
+
+        while (!delta.isConsumed()) {
+            uint32_t offset = delta.read<uint32_t>();
+            std::string bytes = delta.read<std::string>();
+
+            m_state.replace(offset, bytes.size(), bytes);
+        }
+    }
+
+    Snapshot snapshot(m_state);
+    snapshot.setTimeless(tick);
+    for (const auto& [name, component] : components)
+        component->loadState(snapshot);
+    m_tick = tick;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+size_t History::getFirstTick(void) const
+{
+    return (m_segments.empty() ? m_tick : m_segments.front().tick);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+size_t History::getLastTick(void) const
+{
+    if (m_segments.empty())
+        return (m_tick);
+    return (m_segments.back().tick + m_segments.back().deltas.size());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+size_t History::getKeyframes(void) const
+{
+    return (m_segments.size());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+size_t History::getMemory(void) const
+{
+    return (m_memory);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+size_t History::getBudget(void) const
+{
+    return (m_budget);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void History::capture(const ComponentMap& components)
+{
+    m_scratch.clear();
+    m_offsets.clear();
+    for (const auto& [name, component] : components) {
+        m_offsets.push_back(m_scratch.getBytes().size());
+        component->saveState(m_scratch);
+    }
+    m_offsets.push_back(m_scratch.getBytes().size());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void History::startSegment(void)
+{
+    m_segments.push_back({m_tick, m_state, {}, cost(m_state)});
+    m_memory += m_segments.back().bytes;
+    evict();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void History::truncate(void)
+{
+    while (m_segments.size() > 1 && m_segments.back().tick > m_tick) {
+        m_memory -= m_segments.back().bytes;
+        m_segments.pop_back();
+    }
+
+    Segment& segment = m_segments.back();
+    while (segment.tick + segment.deltas.size() > m_tick) {
+        segment.bytes -= cost(segment.deltas.back());
+        m_memory -= cost(segment.deltas.back());
+        segment.deltas.pop_back();
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void History::evict(void)
+{
+    while (m_memory > m_budget && m_segments.size() > 1) {
+        m_memory -= m_segments.front().bytes;
+        m_segments.pop_front();
+    }
+}
+
+} // namespace nts
@@ -0,0 +1,179 @@
+///////////////////////////////////////////////////////////////////////////////
+// Header guard
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Snapshot.hpp"
+#include "Engines/IEngine.hpp"
+#include <deque>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace nts
+///////////////////////////////////////////////////////////////////////////////
+namespace nts
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Bounded record of the recent states of a circuit
+///
+/// The record is a list of segments, each starting with a keyframe holding
+/// the timeless saveState bytes of every component, followed by one delta
+/// per tick holding only the components whose state changed. A segment ends after
+/// KEYFRAME_TICKS deltas, or once its deltas outweigh its keyframe, so any
+/// tick is rebuilt from one keyframe and a bounded number of deltas. When
+/// the record outgrows its budget, the oldest segments are dropped.
+///
+///////////////////////////////////////////////////////////////////////////////
+class History
+{
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    // Type alias
+    ///////////////////////////////////////////////////////////////////////////
+    using ComponentMap = Engines::IEngine::ComponentMap;
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief A keyframe and the deltas following it
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct Segment
+    {
+        size_t tick;                        //<! Of the keyframe
+        std::string keyframe;               //<!
+        std::vector<std::string> deltas;    //<! deltas[k] leads to tick+k+1
+        size_t bytes;                       //<! Keyframe and deltas
+    };
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    // Private properties
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr size_t KEYFRAME_TICKS = 256;   //<! Deltas per segment
+    size_t m_budget;                    //<! In bytes
+    size_t m_memory{0};                 //<! Used by the segments
+    size_t m_tick{0};                   //<! Of m_state
+    std::deque<Segment> m_segments;     //<! Oldest first
+    std::string m_state;                //<! Every component at m_tick
+    std::vector<size_t> m_offsets;      //<! Of each component in m_state
+    Snapshot m_scratch;                 //<! Timeless, reused by captures
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param budget Bytes the record may use, at least one segment is kept
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    explicit History(size_t budget);
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Forget everything and start over from the current state
+    ///
+    /// \param components
+    /// \param tick
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void reset(const ComponentMap& components, size_t tick);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Record the state reached by a new tick
+    ///
+    /// Ticks recorded after the current one, left by a restore, are dropped
+    /// first. A tick that does not follow the current one, or a change in
+    /// the components, starts the record over.
+    ///
+    /// \param components
+    /// \param tick
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void record(const ComponentMap& components, size_t tick);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Put every component back in the state it had at a tick
+    ///
+    /// The components also get that tick as the last one they simulated.
+    /// Later ticks are kept, so the record can be walked in both directions
+    /// until the next tick is recorded.
+    ///
+    /// \param components
+    /// \param tick Between getFirstTick and getLastTick
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void restore(const ComponentMap& components, size_t tick);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    size_t getFirstTick(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    size_t getLastTick(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    size_t getKeyframes(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the bytes held by keyframes and deltas
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    size_t getMemory(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    size_t getBudget(void) const;
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Save every component into m_scratch and fill m_offsets
+    ///
+    /// \param components
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void capture(const ComponentMap& components);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Open a segment with m_state as its keyframe
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void startSegment(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Drop the ticks recorded after m_tick
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void truncate(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Drop the oldest segments until the budget is met
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void evict(void);
+};
+
+} // namespace nts
@@ -0,0 +1,53 @@
+///////////////////////////////////////////////////////////////////////////////
+// Header guard
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "IComponent.hpp"
+#include <string>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace nts
+///////////////////////////////////////////////////////////////////////////////
+namespace nts
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Recorder of pin values sampled by a circuit after every tick
+///
+///////////////////////////////////////////////////////////////////////////////
+class ITraceWriter
+{
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief A traced pin
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct Signal
+    {
+        std::string name;           //<! As shown when reading the trace
+        IComponent* component;      //<!
+        size_t pin;                 //<!
+    };
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Write out everything recorded so far
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    virtual ~ITraceWriter() = default;
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Record the signals that changed since the previous sample
+    ///
+    /// \param tick
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    virtual void sample(size_t tick) = 0;
+};
+
+} // namespace nts
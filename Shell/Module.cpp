@@ -0,0 +1,119 @@
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Module.hpp"
+#include "Errors/ComponentException.hpp"
+#include "Errors/ParsingException.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace nts
+///////////////////////////////////////////////////////////////////////////////
+namespace nts
+{
+
+///////////////////////////////////////////////////////////////////////////////
+void Module::addComponent(const std::string& type, const std::string& name)
+{
+    if (m_names.count(name) || m_instances.count(name))
+        throw ComponentException("Component already exists: " + name);
+    m_names.insert(name);
+    m_chipsets.push_back({type, name});
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Module::addInstance(
+    const std::string& name,
+    std::shared_ptr<const Module> module
+)
+{
+    const std::string prefix = name + ".";
+
+    if (m_names.count(name) || m_instances.count(name))
+        throw ComponentException("Component already exists: " + name);
+    for (const Circuit::ChipsetDeclaration& chipset : module->m_chipsets)
+        addComponent(chipset.type, prefix + chipset.name);
+    for (const Circuit::LinkDeclaration& link : module->m_links)
+        setLink(prefix + link.component1, link.pin1,
+            prefix + link.component2, link.pin2);
+    m_instances[name] = std::move(module);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Module::setLink(
+    const std::string& component1,
+    size_t pin1,
+    const std::string& component2,
+    size_t pin2
+)
+{
+    if (!m_names.count(component1))
+        throw ComponentException("Unknown component: " + component1);
+    if (!m_names.count(component2))
+        throw ComponentException("Unknown component: " + component2);
+    m_links.push_back({component1, pin1, component2, pin2});
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool Module::isInstance(const std::string& name) const
+{
+    return (m_instances.count(name) != 0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector<Module::Endpoint> Module::getPort(
+    const std::string& instance,
+    const std::string& port
+) const
+{
+    const Module& module = *m_instances.at(instance);
+    auto it = module.m_ports.find(port);
+    std::vector<Endpoint> endpoints;
+
+    if (it == module.m_ports.end())
+        throw ParsingException("Unknown port: " + instance + ":" + port);
+    for (const Endpoint& endpoint : it->second)
+        endpoints.push_back({instance + "." + endpoint.component,
+            endpoint.pin});
+    return (endpoints);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Module::exportPorts(void)
+{
+    for (const Circuit::ChipsetDeclaration& chipset : m_chipsets) {
+        if (chipset.type == "input" || chipset.type == "output")
+            m_ports[chipset.name];
+    }
+
+    std::erase_if(m_links, [this](const Circuit::LinkDeclaration& link) {
+        bool port1 = m_ports.count(link.component1);
+        bool port2 = m_ports.count(link.component2);
+
+        if (port1 && port2)
+            throw ParsingException("Ports cannot be linked together: "
+                + link.component1 + " " + link.component2);
+        if ((port1 && link.pin1 != 0) || (port2 && link.pin2 != 0))
+            throw ParsingException("Invalid pin number for port: "
+                + (port1 ? link.component1 : link.component2));
+        if (port1)
+            m_ports[link.component1].push_back({link.component2, link.pin2});
+        if (port2)
+            m_ports[link.component2].push_back({link.component1, link.pin1});
+        return (port1 || port2);
+    });
+    std::erase_if(m_chipsets, [this](const auto& chipset) {
+        return (m_ports.count(chipset.name) != 0);
+    });
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Module::build(Circuit& circuit) const
+{
+    for (const Circuit::ChipsetDeclaration& chipset : m_chipsets)
+        circuit.addComponent(chipset.type, chipset.name);
+    for (const Circuit::LinkDeclaration& link : m_links)
+        circuit.setLink(link.component1, link.pin1,
+            link.component2, link.pin2);
+}
+
+} // namespace nts
@@ -0,0 +1,139 @@
+///////////////////////////////////////////////////////////////////////////////
+// Header guard
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Circuit.hpp"
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace nts
+///////////////////////////////////////////////////////////////////////////////
+namespace nts
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Flat declarations of a parsed `.nts` file, reusable as a chip
+///
+/// A module records chipsets and links without creating any component.
+/// Once exported, its `input` and `output` chipsets become named ports:
+/// each one stands for the pins it was linked to inside the module, and
+/// instantiating the module copies the remaining declarations into a parent
+/// under `<instance>.<name>`. Nested modules are already flattened when they
+/// are recorded, so an exported module only holds primitive chipsets.
+///
+///////////////////////////////////////////////////////////////////////////////
+class Module
+{
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief A pin of a recorded chipset
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct Endpoint
+    {
+        std::string component;      //<!
+        size_t pin;                 //<!
+    };
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    // Private properties
+    ///////////////////////////////////////////////////////////////////////////
+    std::vector<Circuit::ChipsetDeclaration> m_chipsets;    //<!
+    std::vector<Circuit::LinkDeclaration> m_links;          //<!
+    std::unordered_set<std::string> m_names;                //<! Chipsets
+    std::unordered_map<
+        std::string,                                        //<! Port
+        std::vector<Endpoint>                               //<! Pins inside
+    > m_ports;                                              //<!
+    std::unordered_map<
+        std::string,                                        //<! Instance
+        std::shared_ptr<const Module>                       //<! Template
+    > m_instances;                                          //<!
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param type
+    /// \param name
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void addComponent(const std::string& type, const std::string& name);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Copy the declarations of an exported module under a prefix
+    ///
+    /// \param name Instance name
+    /// \param module
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void addInstance(
+        const std::string& name,
+        std::shared_ptr<const Module> module
+    );
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param component1
+    /// \param pin1
+    /// \param component2
+    /// \param pin2
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void setLink(
+        const std::string& component1,
+        size_t pin1,
+        const std::string& component2,
+        size_t pin2
+    );
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param name
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    bool isInstance(const std::string& name) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the pins a port of an instance stands for
+    ///
+    /// \param instance
+    /// \param port
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    std::vector<Endpoint> getPort(
+        const std::string& instance,
+        const std::string& port
+    ) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Turn `input` and `output` chipsets into ports
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void exportPorts(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Create every recorded chipset and link in a circuit
+    ///
+    /// \param circuit
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void build(Circuit& circuit) const;
+};
+
+} // namespace nts
@@ -3,6 +3,7 @@
 ///////////////////////////////////////////////////////////////////////////////
 #include "Parser.hpp"
 #include "Errors/ParsingException.hpp"
+#include <filesystem>
 #include <string>
 #include <sstream>
 #include <fstream>
@@ -14,61 +15,19 @@ namespace nts
 {
 
 ///////////////////////////////////////////////////////////////////////////////
-void Parser::parseChipset(Circuit& circuit, const std::string& line)
-{
-    std::istringstream iss(line);
-    std::string type, name;
-
-    if (!(iss >> type >> name))
-        throw ParsingException("Invalid chipset definition: " + line);
-    circuit.addComponent(type, name);
-}
-
-///////////////////////////////////////////////////////////////////////////////
-void Parser::parseLink(Circuit& circuit, const std::string& line)
-{
-    std::istringstream iss(line);
-    std::string link1, link2;
-
-    if (!(iss >> link1 >> link2))
-        throw ParsingException("Invalid link definition: " + line);
-
-    size_t colon1 = link1.find(':');
-    if (colon1 == std::string::npos)
-        throw ParsingException("Invalid component link format: " + link1);
-
-    std::string component1 = link1.substr(0, colon1);
-    size_t pin1;
-    try {
-        pin1 = std::stoul(link1.substr(colon1 + 1));
-    } catch (const std::exception&) {
-        throw ParsingException("Invalid pin number for component: " + link1);
-    }
-
-    size_t colon2 = link2.find(':');
-    if (colon2 == std::string::npos)
-        throw ParsingException("Invalid component link format: " + link2);
-
-    std::string component2 = link2.substr(0, colon2);
-    size_t pin2;
-    try {
-        pin2 = std::stoul(link2.substr(colon2 + 1));
-    } catch (const std::exception&) {
-        throw ParsingException("Invalid pin number for component: " + link2);
-    }
-
-    circuit.setLink(component1, pin1 - 1, component2, pin2 - 1);
-}
-
-///////////////////////////////////////////////////////////////////////////////
-void Parser::parseCircuit(Circuit& circuit, const std::string& filename)
+Module Parser::parseModule(const std::string& filename, ModuleMap& cache)
 {
     std::ifstream file(filename);
     if (!file.is_open())
         throw ParsingException("Cannot open circuit file: " + filename);
 
+    std::string directory =
+        std::filesystem::path(filename).parent_path().string();
     std::string line;
+    Module module;
+    ModuleMap types;
 
+    bool inModules = false;
     bool inChipsets = false;
     bool inLinks = false;
 
@@ -84,22 +43,131 @@ void Parser::parseCircuit(Circuit& circuit, const std::string& filename)
         if (line.empty())
             continue;
 
-        if (line == ".chipsets:") {
+        if (line == ".modules:") {
+            inModules = true;
+            inChipsets = false;
+            inLinks = false;
+            continue;
+        } else if (line == ".chipsets:") {
+            inModules = false;
             inChipsets = true;
             inLinks = false;
             continue;
         } else if (line == ".links:") {
+            inModules = false;
             inChipsets = false;
             inLinks = true;
             continue;
         }
 
-        if (inChipsets)   parseChipset(circuit, line);
-        else if (inLinks) parseLink(circuit, line);
+        if (inModules)          parseInclude(types, line, directory, cache);
+        else if (inChipsets)    parseChipset(module, types, line);
+        else if (inLinks)       parseLink(module, line);
+    }
+    return (module);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Parser::parseInclude(
+    ModuleMap& types,
+    const std::string& line,
+    const std::string& directory,
+    ModuleMap& cache
+)
+{
+    std::istringstream iss(line);
+    std::string type, filename;
+
+    if (!(iss >> type >> filename))
+        throw ParsingException("Invalid module definition: " + line);
+    if (types.count(type))
+        throw ParsingException("Module already declared: " + type);
+
+    std::filesystem::path path = std::filesystem::path(directory) / filename;
+    std::string key = std::filesystem::weakly_canonical(path).string();
+
+    auto it = cache.find(key);
+    if (it != cache.end() && !it->second)
+        throw ParsingException("Recursive module: " + filename);
+    if (it == cache.end()) {
+        cache[key] = nullptr;
+        Module module = parseModule(path.string(), cache);
+        module.exportPorts();
+        it = cache.insert_or_assign(key,
+            std::make_shared<const Module>(std::move(module))).first;
+    }
+    types[type] = it->second;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Parser::parseChipset(
+    Module& module,
+    const ModuleMap& types,
+    const std::string& line
+)
+{
+    std::istringstream iss(line);
+    std::string type, name;
+
+    if (!(iss >> type >> name))
+        throw ParsingException("Invalid chipset definition: " + line);
+
+    auto it = types.find(type);
+    if (it != types.end())
+        module.addInstance(name, it->second);
+    else
+        module.addComponent(type, name);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Parser::parseLink(Module& module, const std::string& line)
+{
+    std::istringstream iss(line);
+    std::string link1, link2;
+
+    if (!(iss >> link1 >> link2))
+        throw ParsingException("Invalid link definition: " + line);
+
+    // A port stands for every pin it reaches inside its module
+    for (const Module::Endpoint& end1 : parseEndpoint(module, link1)) {
+        for (const Module::Endpoint& end2 : parseEndpoint(module, link2))
+            module.setLink(end1.component, end1.pin,
+                end2.component, end2.pin);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector<Module::Endpoint> Parser::parseEndpoint(
+    const Module& module,
+    const std::string& link
+)
+{
+    size_t colon = link.find(':');
+    if (colon == std::string::npos)
+        throw ParsingException("Invalid component link format: " + link);
+
+    std::string component = link.substr(0, colon);
+    if (module.isInstance(component))
+        return (module.getPort(component, link.substr(colon + 1)));
+
+    size_t pin;
+    try {
+        pin = std::stoul(link.substr(colon + 1));
+    } catch (const std::exception&) {
+        throw ParsingException("Invalid pin number for component: " + link);
     }
+    return (std::vector<Module::Endpoint>{{component, pin - 1}});
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Parser::parseCircuit(Circuit& circuit, const std::string& filename)
+{
+    ModuleMap cache;
 
+    parseModule(filename, cache).build(circuit);
     if (circuit.getComponents().empty())
         throw ParsingException("No chipsets found in the circuit");
+    circuit.compile();
 }
 
 } // namespace nts
@@ -7,7 +7,11 @@
 // Dependencies
 ///////////////////////////////////////////////////////////////////////////////
 #include "Circuit.hpp"
+#include "Module.hpp"
+#include <memory>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 ///////////////////////////////////////////////////////////////////////////////
 // Namespace nts
@@ -18,27 +22,88 @@ namespace nts
 ///////////////////////////////////////////////////////////////////////////////
 /// \brief
 ///
+/// Besides `.chipsets:` and `.links:`, a file may start with a `.modules:`
+/// section of `<type> <file>` lines, paths being relative to the file. A
+/// chipset of such a type instantiates the other file as a chip, and its
+/// ports are linked by name, as in `adder:a0`. Each module file is parsed
+/// once per load and every instance is copied from that template.
+///
 ///////////////////////////////////////////////////////////////////////////////
 class Parser
 {
-    private:
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    // Type alias
+    ///////////////////////////////////////////////////////////////////////////
+    using ModuleMap = std::unordered_map<
+        std::string,
+        std::shared_ptr<const Module>
+    >;
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Parse a file into declarations
+    ///
+    /// \param filename
+    /// \param cache Parsed modules by canonical path, `nullptr` while loading
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static Module parseModule(const std::string& filename, ModuleMap& cache);
+
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
     ///
-    /// \param circuit
+    /// \param types Module types declared so far
     /// \param line
+    /// \param directory Directory of the file being parsed
+    /// \param cache
     ///
     ///////////////////////////////////////////////////////////////////////////
-    static void parseChipset(Circuit& circuit, const std::string& line);
+    static void parseInclude(
+        ModuleMap& types,
+        const std::string& line,
+        const std::string& directory,
+        ModuleMap& cache
+    );
 
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
     ///
-    /// \param circuit
+    /// \param module
+    /// \param types
     /// \param line
     ///
     ///////////////////////////////////////////////////////////////////////////
-    static void parseLink(Circuit& circuit, const std::string& line);
+    static void parseChipset(
+        Module& module,
+        const ModuleMap& types,
+        const std::string& line
+    );
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param module
+    /// \param line
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static void parseLink(Module& module, const std::string& line);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Pins named by one side of a link
+    ///
+    /// \param module
+    /// \param link `<component>:<pin>` or `<instance>:<port>`
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static std::vector<Module::Endpoint> parseEndpoint(
+        const Module& module,
+        const std::string& link
+    );
 
 public:
     ///////////////////////////////////////////////////////////////////////////
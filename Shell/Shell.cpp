@@ -2,9 +2,14 @@
 // Dependencies
 ///////////////////////////////////////////////////////////////////////////////
 #include "Shell.hpp"
+#include "CycleDetector.hpp"
 #include "Parser.hpp"
 #include "Pin.hpp"
 #include <signal.h>
+#include <chrono>
+#include <csignal>
+#include <fstream>
+#include <sstream>
 #include <vector>
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -13,17 +18,67 @@
 namespace nts
 {
 
+///////////////////////////////////////////////////////////////////////////////
+static volatile std::sig_atomic_t Interrupted = 0;
+
+///////////////////////////////////////////////////////////////////////////////
+static bool parseCount(const std::string& arguments, size_t& count)
+{
+    std::istringstream stream(arguments);
+
+    if ((stream >> std::ws).eof())
+        return (true);
+    if (!(stream >> count) || !(stream >> std::ws).eof())
+        return (false);
+    return (count != 0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+static bool isCommand(const std::string& command, const std::string& name)
+{
+    return (command.rfind(name, 0) == 0 && (command.size() == name.size()
+        || command[name.size()] == ' '));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+static std::string parseFilename(
+    const std::string& arguments,
+    const std::string& command
+)
+{
+    std::istringstream stream(arguments);
+    std::string filename;
+
+    if (!(stream >> filename) || !(stream >> std::ws).eof())
+        throw std::runtime_error("Usage: " + command + " <file>");
+    return (filename);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 void Shell::handleSigint(int)
 {
-    exit(0);
+    Interrupted = 1;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 Shell::Shell(void)
+    : Shell(std::cin, std::cout, std::cerr)
+{}
+
+///////////////////////////////////////////////////////////////////////////////
+Shell::Shell(std::istream& input, std::ostream& output, std::ostream& errors)
     : m_running(true)
+    , m_input(input)
+    , m_output(output)
+    , m_errors(errors)
 {
-    signal(SIGINT, Shell::handleSigint);
+    struct sigaction action = {};
+
+    // Without SA_RESTART, a pending read fails and ends the command loop
+    action.sa_handler = Shell::handleSigint;
+    sigemptyset(&action.sa_mask);
+    sigaction(SIGINT, &action, nullptr);
+    m_circuit.setOutput(m_output);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -32,23 +87,47 @@ void Shell::loadCircuit(const std::string& filename)
     Parser::parseCircuit(m_circuit, filename);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+void Shell::loadCircuit(const Circuit& prototype)
+{
+    prototype.cloneInto(m_circuit);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Shell::setEngine(const std::string& name)
+{
+    m_circuit.setEngine(name);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Shell::setThreads(size_t count)
+{
+    m_circuit.setThreads(count);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Shell::setCompact(bool compact)
+{
+    m_circuit.setCompact(compact);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 void Shell::displayDebugInfo(void)
 {
-    std::cout << "===== Circuit Debug Information =====" << std::endl;
-    std::cout << "Components: "
-              << m_circuit.getComponents().size() << std::endl;
+    m_output << "===== Circuit Debug Information =====" << std::endl;
+    m_output << "Components: "
+           << m_circuit.getComponents().size() << std::endl;
 
     for (const auto& [name, component] : m_circuit.getComponents()) {
-        std::cout << "\n[Component] " << name << std::endl;
+        m_output << "\n[Component] " << name << std::endl;
 
         if (!component) {
-            std::cout << "  WARNING: Null component" << std::endl;
+            m_output << "  WARNING: Null component" << std::endl;
             continue;
         }
 
-        std::vector<Pin>& pins = component->getPins();
-        std::cout << "  Pin count: " << pins.size() << std::endl;
+        std::pmr::vector<Pin>& pins = component->getPins();
+        m_output << "  Pin count: " << pins.size() << std::endl;
 
         for (size_t i = 0; i < pins.size(); i++) {
             Pin& pin = pins[i];
@@ -69,29 +148,29 @@ void Shell::displayDebugInfo(void)
                 default:                   stateStr = "INVALID"; break;
             }
 
-            std::cout << "  Pin " << i
-                      << " [" << typeStr << "] State: "
-                      << stateStr << std::endl;
+            m_output << "  Pin " << i
+                   << " [" << typeStr << "] State: "
+                   << stateStr << std::endl;
 
             const auto& links = pin.getLinks();
             if (links.empty()) {
-                std::cout << "    No links" << std::endl;
+                m_output << "    No links" << std::endl;
             } else {
-                std::cout << "    Links (" << links.size()
-                          << "):" << std::endl;
+                m_output << "    Links (" << links.size()
+                       << "):" << std::endl;
                 for (const auto& link : links) {
                     if (auto linkedComponent = link.component.lock()) {
-                        std::cout << "      -> " << linkedComponent->getName()
-                                  << " (pin " << link.pin << ")" << std::endl;
+                        m_output << "      -> " << linkedComponent->getName()
+                               << " (pin " << link.pin << ")" << std::endl;
                     } else {
-                        std::cout << "      -> EXPIRED LINK" << std::endl;
+                        m_output << "      -> EXPIRED LINK" << std::endl;
                     }
                 }
             }
         }
     }
 
-    std::cout << "\n===== End Debug Information =====" << std::endl;
+    m_output << "\n===== End Debug Information =====" << std::endl;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -100,10 +179,51 @@ void Shell::processCommand(const std::string& command)
     if (command.empty()) return;
 
     if (command == "exit")      { m_running = false; return; }
-    if (command == "display")   { m_circuit.display(); return; }
-    if (command == "simulate")  { m_circuit.simulate(); return; }
-    if (command == "loop")      { runLoop(); return; }
     if (command == "debug")     { displayDebugInfo(); return; }
+    if (isCommand(command, "loop")) {
+        runLoop(command.substr(4));
+        return;
+    }
+    if (isCommand(command, "display")) {
+        runDisplay(command.substr(7));
+        return;
+    }
+    if (isCommand(command, "simulate")) {
+        runSimulate(command.substr(8));
+        return;
+    }
+    if (isCommand(command, "trace")) {
+        runTrace(command.substr(5));
+        return;
+    }
+    if (isCommand(command, "save")) {
+        m_circuit.saveState(parseFilename(command.substr(4), "save"));
+        return;
+    }
+    if (isCommand(command, "load-state")) {
+        m_circuit.loadState(parseFilename(command.substr(10), "load-state"));
+        return;
+    }
+    if (isCommand(command, "history")) {
+        runHistory(command.substr(7));
+        return;
+    }
+    if (isCommand(command, "back")) {
+        runRewind(command.substr(4), true);
+        return;
+    }
+    if (isCommand(command, "goto")) {
+        runRewind(command.substr(4), false);
+        return;
+    }
+    if (isCommand(command, "fast-forward")) {
+        runFastForward(command.substr(12));
+        return;
+    }
+    if (isCommand(command, "patterns")) {
+        runPatterns(command.substr(8));
+        return;
+    }
 
     size_t equalPos = command.find('=');
     if (equalPos != std::string::npos) {
@@ -128,12 +248,224 @@ void Shell::processCommand(const std::string& command)
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void Shell::runLoop(void)
+void Shell::runPatterns(const std::string& arguments)
 {
-    while (true) {
+    size_t count = 0;
+
+    if (!parseCount(arguments, count))
+        throw std::runtime_error("Usage: patterns [vector count]");
+    m_circuit.displayPatterns(count);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Shell::runSimulate(const std::string& arguments)
+{
+    size_t count = 1;
+
+    if (!parseCount(arguments, count))
+        throw std::runtime_error("Usage: simulate [tick count]");
+
+    // Inputs only change before the first tick, so a repeated state means
+    // every tick after it repeats too
+    CycleDetector cycles;
+    bool skipping = m_fastForward && m_displayEvery == 0 && count > 1
+        && m_circuit.canSkip();
+
+    for (size_t i = 0; i < count && !Interrupted; i++) {
         m_circuit.simulate();
+        if (m_displayEvery != 0 && m_circuit.getTick() % m_displayEvery == 0)
+            m_circuit.display();
+        if (!skipping)
+            continue;
+
+        size_t period = cycles.observe(
+            m_circuit.getComponents(), m_circuit.getTick());
+        size_t skipped = period ? (count - i - 1) / period * period : 0;
+
+        m_circuit.skip(skipped);
+        if (skipped != 0)
+            m_errors << "fast-forward: period of " << period << " ticks, "
+                     << skipped << " ticks skipped" << std::endl;
+        i += skipped;
+        skipping = (period == 0 && !cycles.isExhausted());
+    }
+    Interrupted = 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Shell::runDisplay(const std::string& arguments)
+{
+    std::istringstream stream(arguments);
+    std::string keyword;
+    size_t every = 0;
+
+    if (!(stream >> keyword)) {
         m_circuit.display();
+        return;
     }
+    if (keyword != "every" || !(stream >> every)
+        || !(stream >> std::ws).eof())
+        throw std::runtime_error("Usage: display [every <tick count>]");
+    m_displayEvery = every;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Shell::runLoop(const std::string& arguments)
+{
+    using Clock = std::chrono::steady_clock;
+    std::istringstream stream(arguments);
+    std::string mode = "every";
+    size_t every = 1;
+
+    if ((stream >> mode) && mode == "every" && !(stream >> every))
+        every = 0;
+    if ((mode != "every" && mode != "changes" && mode != "quiet")
+        || every == 0 || !(stream >> std::ws).eof())
+        throw std::runtime_error(
+            "Usage: loop [every <tick count> | changes | quiet]");
+
+    std::vector<Tristate> previous;
+    std::vector<Tristate> current;
+    size_t ticks = 0;
+    size_t evaluations = m_circuit.getEvaluations();
+    Clock::time_point start = Clock::now();
+
+    m_circuit.readOutputs(previous);
+    while (!Interrupted) {
+        m_circuit.simulate();
+        ticks++;
+        if (mode == "every" && m_circuit.getTick() % every == 0)
+            m_circuit.display();
+        else if (mode == "changes") {
+            m_circuit.readOutputs(current);
+            if (current != previous) {
+                m_circuit.display();
+                previous.swap(current);
+            }
+        }
+    }
+    Interrupted = 0;
+
+    std::chrono::duration<double> elapsed = Clock::now() - start;
+    double seconds = std::max(elapsed.count(), 1e-9);
+    evaluations = m_circuit.getEvaluations() - evaluations;
+    m_output.flush();
+    m_errors << "loop: " << ticks << " ticks in " << elapsed.count()
+             << " s, " << size_t(ticks / seconds) << " ticks/s, "
+             << size_t(evaluations / seconds) << " evaluations/s"
+             << std::endl;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Shell::runTrace(const std::string& arguments)
+{
+    std::istringstream stream(arguments);
+    std::string filename;
+    std::vector<std::string> signals;
+    std::string signal;
+
+    if (!(stream >> filename))
+        throw std::runtime_error("Usage: trace <file> [signals...]"
+            " | trace off");
+    while (stream >> signal)
+        signals.push_back(signal);
+    if (filename == "off" && signals.empty())
+        m_circuit.untrace();
+    else
+        m_circuit.trace(filename, signals);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Shell::runHistory(const std::string& arguments)
+{
+    std::istringstream stream(arguments);
+    std::string keyword;
+    size_t megabytes = 0;
+
+    if (stream >> keyword) {
+        if (keyword == "off" && (stream >> std::ws).eof())
+            m_circuit.setHistory(0);
+        else if (parseCount(arguments, megabytes))
+            setHistory(megabytes);
+        else
+            throw std::runtime_error("Usage: history [<MiB> | off]");
+        return;
+    }
+
+    const History* history = m_circuit.getHistory();
+    if (!history) {
+        m_output << "history: off" << std::endl;
+        return;
+    }
+    m_output << "history: ticks " << history->getFirstTick() << "-"
+             << history->getLastTick() << ", "
+             << history->getKeyframes() << " keyframes, "
+             << history->getMemory() / 1024 << " KiB of "
+             << history->getBudget() / 1024 << " KiB" << std::endl;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Shell::runRewind(const std::string& arguments, bool relative)
+{
+    size_t count = 1;
+
+    if (relative) {
+        if (!parseCount(arguments, count))
+            throw std::runtime_error("Usage: back [tick count]");
+        if (count > m_circuit.getTick())
+            throw std::runtime_error("Cannot go back before tick 0");
+        m_circuit.rewind(m_circuit.getTick() - count);
+        return;
+    }
+
+    std::istringstream stream(arguments);
+    size_t tick = 0;
+
+    if (!(stream >> tick) || !(stream >> std::ws).eof())
+        throw std::runtime_error("Usage: goto <tick>");
+    m_circuit.rewind(tick);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Shell::runFastForward(const std::string& arguments)
+{
+    std::istringstream stream(arguments);
+    std::string mode;
+
+    if (!(stream >> mode) || (mode != "on" && mode != "off")
+        || !(stream >> std::ws).eof())
+        throw std::runtime_error("Usage: fast-forward <on | off>");
+    setFastForward(mode == "on");
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Shell::setHistory(size_t megabytes)
+{
+    m_circuit.setHistory(megabytes << 20);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Shell::setFastForward(bool enabled)
+{
+    m_fastForward = enabled;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Shell::trace(const std::string& filename)
+{
+    m_circuit.trace(filename, {});
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Shell::emitCpp(void)
+{
+    m_circuit.emitCpp(m_output);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Engines::Optimizer::Report Shell::optimize(void)
+{
+    return (m_circuit.optimize());
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -141,16 +473,47 @@ void Shell::run(void)
 {
     std::string command;
 
-    std::cout << "> ";
-    while (m_running && std::getline(std::cin, command)) {
+    m_output << "> ";
+    while (m_running && !Interrupted && std::getline(m_input, command)) {
         try {
             processCommand(command);
         } catch (const std::exception& e) {
-            std::cerr << e.what() << std::endl;
+            m_errors << e.what() << std::endl;
         }
 
         if (m_running)
-            std::cout << "> ";
+            m_output << "> ";
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Shell::runScript(const std::string& filename)
+{
+    std::ifstream file(filename);
+    std::ostringstream contents;
+
+    if (!file.is_open())
+        throw std::runtime_error("Cannot open script file: " + filename);
+    contents << file.rdbuf();
+
+    const std::string script = contents.str();
+    std::string command;
+    size_t line = 0;
+
+    for (size_t start = 0; m_running && !Interrupted
+        && start < script.size(); line++) {
+        size_t end = script.find('\n', start);
+
+        if (end == std::string::npos)
+            end = script.size();
+        command.assign(script, start, end - start);
+        start = end + 1;
+        try {
+            processCommand(command);
+        } catch (const std::exception& e) {
+            m_errors << filename << ":" << line + 1 << ": " << e.what()
+                     << std::endl;
+        }
     }
 }
 
@@ -7,6 +7,7 @@
 // Dependencies
 ///////////////////////////////////////////////////////////////////////////////
 #include "Circuit.hpp"
+#include <iostream>
 
 ///////////////////////////////////////////////////////////////////////////////
 // Namespace nts
@@ -26,18 +27,35 @@ private:
     ///////////////////////////////////////////////////////////////////////////
     Circuit m_circuit;      //<!
     bool m_running;         //<!
+    std::istream& m_input;  //<!
+    std::ostream& m_output; //<!
+    std::ostream& m_errors; //<!
+    size_t m_displayEvery{0};   //<! Ticks between displays, 0 for none
+    bool m_fastForward{false};  //<! Skip repeating states in simulate N
 
 public:
     ///////////////////////////////////////////////////////////////////////////
-    /// \brief
+    /// \brief Interactive shell on the standard streams
     ///
     ///////////////////////////////////////////////////////////////////////////
     Shell(void);
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Shell reading commands and writing results on given streams
+    ///
+    /// \param input
+    /// \param output Prompts and display output
+    /// \param errors Command errors
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Shell(std::istream& input, std::ostream& output, std::ostream& errors);
+
 private:
     ///////////////////////////////////////////////////////////////////////////
-    /// \brief
+    /// \brief Stop a running loop, or the shell when no loop is running
     ///
+    /// The shell stops once the current command is done, or right away when
+    /// waiting for a command, and returns from run() like on end of input.
     ///////////////////////////////////////////////////////////////////////////
     static void handleSigint(int);
 
@@ -57,10 +75,80 @@ private:
     void processCommand(const std::string& command);
 
     ///////////////////////////////////////////////////////////////////////////
-    /// \brief
+    /// \brief Simulate until SIGINT, then report the simulation rate
+    ///
+    /// Displays every tick by default, `every <ticks>` only displays ticks
+    /// that are a multiple of a count, `changes` only ticks where an output
+    /// changed and `quiet` none at all.
+    ///
+    /// \param arguments
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void runLoop(const std::string& arguments);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Simulate a number of ticks, one by default, displaying the
+    /// ones selected by `display every`
+    ///
+    /// With fast-forward on and no display, once the circuit comes back to
+    /// a state it already had during the run, the whole periods left are
+    /// skipped and only the remainder is simulated.
+    ///
+    /// \param arguments
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void runSimulate(const std::string& arguments);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Handle `display` and `display every <ticks>`
+    ///
+    /// \param arguments
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void runDisplay(const std::string& arguments);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Handle `trace <file> [signals...]` and `trace off`
+    ///
+    /// \param arguments
     ///
     ///////////////////////////////////////////////////////////////////////////
-    void runLoop(void);
+    void runTrace(const std::string& arguments);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Run every input combination, or a count of random vectors,
+    /// through the bit-parallel evaluator
+    ///
+    /// \param arguments
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void runPatterns(const std::string& arguments);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Handle `history <MiB>`, `history off`, and `history` alone to
+    /// report the recorded ticks and the memory they use
+    ///
+    /// \param arguments
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void runHistory(const std::string& arguments);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Handle `back [ticks]` and `goto <tick>`
+    ///
+    /// \param arguments
+    /// \param relative True for `back`
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void runRewind(const std::string& arguments, bool relative);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Handle `fast-forward [on | off]`
+    ///
+    /// \param arguments
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void runFastForward(const std::string& arguments);
 
 public:
     ///////////////////////////////////////////////////////////////////////////
@@ -71,11 +159,93 @@ public:
     ///////////////////////////////////////////////////////////////////////////
     void loadCircuit(const std::string& filename);
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Load a copy of an already parsed circuit
+    ///
+    /// \param prototype
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void loadCircuit(const Circuit& prototype);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param name
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void setEngine(const std::string& name);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param count
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void setThreads(size_t count);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Display one line per tick, see Circuit::setCompact
+    ///
+    /// \param compact
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void setCompact(bool compact);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Trace every input, clock and output, see Circuit::trace
+    ///
+    /// \param filename
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void trace(const std::string& filename);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Record recent states for `back` and `goto`, see
+    /// Circuit::setHistory
+    ///
+    /// \param megabytes
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void setHistory(size_t megabytes);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Let `simulate N` skip the periods of a repeating state
+    ///
+    /// \param enabled
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void setFastForward(bool enabled);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Print the loaded circuit as a standalone C++ simulator
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void emitCpp(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Simplify the loaded circuit, see Circuit::optimize
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Engines::Optimizer::Report optimize(void);
+
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
     ///
     ///////////////////////////////////////////////////////////////////////////
     void run(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Run the commands of a file without prompting
+    ///
+    /// The file is read in one go. Failing commands are reported with their
+    /// line number and do not stop the script.
+    ///
+    /// \param filename
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void runScript(const std::string& filename);
 };
 
 } // namespace nts
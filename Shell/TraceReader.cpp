@@ -0,0 +1,210 @@
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "TraceReader.hpp"
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <tuple>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace nts
+///////////////////////////////////////////////////////////////////////////////
+namespace nts
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Bounds-checked reads from a mapped byte range
+///
+///////////////////////////////////////////////////////////////////////////////
+namespace
+{
+class Cursor
+{
+private:
+    const uint8_t* m_current;   //<!
+    const uint8_t* m_end;       //<!
+
+public:
+    Cursor(const uint8_t* data, size_t size)
+        : m_current(data)
+        , m_end(data + size)
+    {}
+
+    const uint8_t* take(size_t size)
+    {
+        if (size > static_cast<size_t>(m_end - m_current))
+            throw std::runtime_error("Corrupted trace file");
+        m_current += size;
+        return (m_current - size);
+    }
+
+    template<typename T>
+    T read(void)
+    {
+        T value;
+        std::memcpy(&value, take(sizeof(T)), sizeof(T));
+        return (value);
+    }
+
+    uint64_t readVarint(void)
+    {
+        uint64_t value = 0;
+
+        for (unsigned shift = 0; shift < 64; shift += 7) {
+            uint8_t byte = *take(1);
+            value |= uint64_t(byte & 0x7F) << shift;
+            if (!(byte & 0x80))
+                return (value);
+        }
+        throw std::runtime_error("Corrupted trace file");
+    }
+};
+} // namespace
+
+///////////////////////////////////////////////////////////////////////////////
+static Tristate fromCode(unsigned code)
+{
+    switch (code) {
+        case 0:     return (Tristate::False);
+        case 1:     return (Tristate::True);
+        default:    return (Tristate::Undefined);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TraceReader::TraceReader(const std::string& filename)
+{
+    int fd = open(filename.c_str(), O_RDONLY);
+    struct stat info;
+
+    if (fd < 0)
+        throw std::runtime_error("Cannot open trace file: " + filename);
+    if (fstat(fd, &info) < 0 || info.st_size == 0) {
+        close(fd);
+        throw std::runtime_error("Invalid trace file: " + filename);
+    }
+    m_size = info.st_size;
+    void* data = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED)
+        throw std::runtime_error("Cannot map trace file: " + filename);
+    m_data = static_cast<const uint8_t*>(data);
+
+    try {
+        Cursor header(m_data, m_size);
+        if (std::memcmp(header.take(sizeof(TraceWriter::MAGIC)),
+            TraceWriter::MAGIC, sizeof(TraceWriter::MAGIC)) != 0
+            || header.read<uint32_t>() != TraceWriter::VERSION)
+            throw std::runtime_error("Not a trace file: " + filename);
+        m_signals.resize(header.read<uint32_t>());
+        for (std::string& name : m_signals) {
+            uint32_t length = header.read<uint32_t>();
+            name.assign(reinterpret_cast<const char*>(header.take(length)),
+                length);
+        }
+
+        size_t trailer = 2 * sizeof(uint64_t) + sizeof(TraceWriter::MAGIC);
+        if (m_size < trailer)
+            throw std::runtime_error("Truncated trace file: " + filename);
+        Cursor footer(m_data + m_size - trailer, trailer);
+        uint64_t offset = footer.read<uint64_t>();
+        uint64_t count = footer.read<uint64_t>();
+        if (std::memcmp(footer.take(sizeof(TraceWriter::INDEX_MAGIC)),
+            TraceWriter::INDEX_MAGIC, sizeof(TraceWriter::INDEX_MAGIC)) != 0
+            || offset > m_size - trailer
+            || count > (m_size - trailer - offset)
+                / sizeof(TraceWriter::IndexEntry))
+            throw std::runtime_error("Truncated trace file: " + filename);
+        m_index.resize(count);
+        std::memcpy(m_index.data(), m_data + offset,
+            count * sizeof(TraceWriter::IndexEntry));
+    } catch (...) {
+        munmap(const_cast<uint8_t*>(m_data), m_size);
+        throw;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TraceReader::~TraceReader()
+{
+    munmap(const_cast<uint8_t*>(m_data), m_size);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+const std::vector<std::string>& TraceReader::getSignals(void) const
+{
+    return (m_signals);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+size_t TraceReader::getFirstTick(void) const
+{
+    return (m_index.empty() ? 0 : m_index.front().first);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+size_t TraceReader::getLastTick(void) const
+{
+    return (m_index.empty() ? 0 : m_index.back().last);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void TraceReader::read(size_t from, size_t to, const Visitor& visitor) const
+{
+    using Change = std::tuple<uint64_t, uint32_t, uint8_t>;
+    std::vector<Tristate> values(m_signals.size(), Tristate::Undefined);
+    std::vector<Change> changes;
+    bool started = false;
+
+    auto chunk = std::lower_bound(m_index.begin(), m_index.end(), from,
+        [](const TraceWriter::IndexEntry& entry, size_t tick) {
+            return (entry.last < tick);
+        });
+    for (; chunk != m_index.end() && chunk->first <= to; chunk++) {
+        if (chunk->offset > m_size || chunk->size > m_size - chunk->offset)
+            throw std::runtime_error("Corrupted trace file");
+        Cursor cursor(m_data + chunk->offset, chunk->size);
+        const uint8_t* entry = cursor.take((m_signals.size() + 3) / 4);
+
+        if (!started) {
+            for (size_t i = 0; i < values.size(); i++)
+                values[i] = fromCode((entry[i / 4] >> (i % 4 * 2)) & 3);
+        }
+        changes.clear();
+        uint64_t signals = cursor.readVarint();
+        for (uint64_t s = 0, index = 0; s < signals; s++) {
+            index += cursor.readVarint();
+            if (index >= m_signals.size())
+                throw std::runtime_error("Corrupted trace file");
+            uint64_t tick = chunk->first;
+            for (uint64_t n = cursor.readVarint(); n > 0; n--) {
+                uint64_t change = cursor.readVarint();
+                tick += change >> 2;
+                changes.emplace_back(tick, index, change & 3);
+            }
+        }
+        std::sort(changes.begin(), changes.end());
+
+        auto it = changes.begin();
+        if (!started) {
+            from = std::max<size_t>(from, chunk->first);
+            for (; it != changes.end() && std::get<0>(*it) <= from; it++)
+                values[std::get<1>(*it)] = fromCode(std::get<2>(*it));
+            visitor(from, values);
+            started = true;
+        }
+        while (it != changes.end() && std::get<0>(*it) <= to) {
+            uint64_t tick = std::get<0>(*it);
+            for (; it != changes.end() && std::get<0>(*it) == tick; it++)
+                values[std::get<1>(*it)] = fromCode(std::get<2>(*it));
+            visitor(tick, values);
+        }
+    }
+}
+
+} // namespace nts
@@ -0,0 +1,105 @@
+///////////////////////////////////////////////////////////////////////////////
+// Header guard
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "TraceWriter.hpp"
+#include "Tristate.hpp"
+#include <functional>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace nts
+///////////////////////////////////////////////////////////////////////////////
+namespace nts
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Memory-mapped access to a trace written by TraceWriter
+///
+/// Opening only reads the header and the chunk index. A range read binary
+/// searches the index and decodes the chunks overlapping the range, so the
+/// cost does not depend on where the range lies in the file.
+///
+///////////////////////////////////////////////////////////////////////////////
+class TraceReader
+{
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    // Type alias
+    ///////////////////////////////////////////////////////////////////////////
+    using Visitor = std::function<
+        void(size_t tick, const std::vector<Tristate>& values)
+    >;
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    // Private properties
+    ///////////////////////////////////////////////////////////////////////////
+    const uint8_t* m_data{nullptr};                 //<! Whole file
+    size_t m_size{0};                               //<!
+    std::vector<std::string> m_signals;             //<!
+    std::vector<TraceWriter::IndexEntry> m_index;   //<!
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Map a trace file and load its index
+    ///
+    /// \param filename
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    explicit TraceReader(const std::string& filename);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    ~TraceReader();
+
+    TraceReader(const TraceReader&) = delete;
+    TraceReader& operator=(const TraceReader&) = delete;
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return Signal names, in the order of the visited values
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    const std::vector<std::string>& getSignals(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return First recorded tick, 0 for an empty trace
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    size_t getFirstTick(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return Last recorded tick, 0 for an empty trace
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    size_t getLastTick(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Visit the values at the start of a tick range, then at every
+    /// tick of the range where one of them changed
+    ///
+    /// The range is clipped to the recorded ticks.
+    ///
+    /// \param from
+    /// \param to Included
+    /// \param visitor
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void read(size_t from, size_t to, const Visitor& visitor) const;
+};
+
+} // namespace nts
@@ -0,0 +1,188 @@
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "TraceWriter.hpp"
+#include <stdexcept>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace nts
+///////////////////////////////////////////////////////////////////////////////
+namespace nts
+{
+
+///////////////////////////////////////////////////////////////////////////////
+static size_t appendVarint(std::string& bytes, uint64_t value)
+{
+    size_t size = 1;
+
+    while (value >= 0x80) {
+        bytes += static_cast<char>((value & 0x7F) | 0x80);
+        value >>= 7;
+        size++;
+    }
+    bytes += static_cast<char>(value);
+    return (size);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+static uint8_t toCode(Tristate value)
+{
+    switch (value) {
+        case Tristate::False:   return (0);
+        case Tristate::True:    return (1);
+        default:                return (2);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TraceWriter::TraceWriter(
+    const std::string& filename,
+    std::vector<Signal> signals
+)
+    : m_signals(std::move(signals))
+    , m_values(m_signals.size(), toCode(Tristate::Undefined))
+    , m_entry(m_values)
+    , m_changes(m_signals.size())
+    , m_counts(m_signals.size(), 0)
+    , m_lastTicks(m_signals.size(), 0)
+    , m_file(std::fopen(filename.c_str(), "wb"))
+{
+    if (!m_file)
+        throw std::runtime_error("Cannot create " + filename);
+
+    uint32_t count = static_cast<uint32_t>(m_signals.size());
+    write(MAGIC, sizeof(MAGIC));
+    write(&VERSION, sizeof(VERSION));
+    write(&count, sizeof(count));
+    for (const Signal& signal : m_signals) {
+        uint32_t length = static_cast<uint32_t>(signal.name.size());
+        write(&length, sizeof(length));
+        write(signal.name.data(), length);
+    }
+    m_thread = std::thread(&TraceWriter::drain, this);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TraceWriter::~TraceWriter()
+{
+    try {
+        seal();
+    } catch (const std::exception&) {
+        // The write error was already recorded, the index is still useful
+    }
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = true;
+    }
+    m_ready.notify_one();
+    m_thread.join();
+
+    uint64_t offset = m_offset;
+    uint64_t count = m_index.size();
+    for (const IndexEntry& entry : m_index)
+        write(&entry, sizeof(entry));
+    write(&offset, sizeof(offset));
+    write(&count, sizeof(count));
+    write(INDEX_MAGIC, sizeof(INDEX_MAGIC));
+    std::fclose(m_file);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void TraceWriter::sample(size_t tick)
+{
+    if (m_empty) {
+        m_first = tick;
+        m_empty = false;
+    }
+    for (size_t i = 0; i < m_signals.size(); i++) {
+        const Signal& signal = m_signals[i];
+        uint8_t value = toCode(signal.component->compute(signal.pin));
+
+        if (value == m_values[i])
+            continue;
+        uint64_t previous = m_counts[i] ? m_lastTicks[i] : m_first;
+        m_bytes += appendVarint(m_changes[i], ((tick - previous) << 2)
+            | value);
+        m_counts[i]++;
+        m_lastTicks[i] = tick;
+        m_values[i] = value;
+    }
+    m_last = tick;
+    if (m_bytes >= CHUNK_BYTES || m_last - m_first + 1 >= CHUNK_TICKS)
+        seal();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void TraceWriter::seal(void)
+{
+    if (m_empty)
+        return;
+
+    Chunk chunk{m_first, m_last, {}};
+    size_t changed = 0;
+    size_t previous = 0;
+
+    chunk.bytes.reserve(m_bytes + m_signals.size());
+    for (size_t i = 0; i < m_entry.size(); i += 4) {
+        uint8_t packed = 0;
+        for (size_t j = i; j < i + 4 && j < m_entry.size(); j++)
+            packed |= m_entry[j] << ((j - i) * 2);
+        chunk.bytes += static_cast<char>(packed);
+    }
+    for (uint32_t count : m_counts)
+        changed += (count != 0);
+    appendVarint(chunk.bytes, changed);
+    for (size_t i = 0; i < m_signals.size(); i++) {
+        if (m_counts[i] == 0)
+            continue;
+        appendVarint(chunk.bytes, i - previous);
+        appendVarint(chunk.bytes, m_counts[i]);
+        chunk.bytes += m_changes[i];
+        m_changes[i].clear();
+        m_counts[i] = 0;
+        previous = i;
+    }
+    m_entry = m_values;
+    m_bytes = 0;
+    m_empty = true;
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_room.wait(lock, [this] { return (m_queue.size() < QUEUE); });
+    if (m_failed)
+        throw std::runtime_error("Cannot write the trace file");
+    m_queue.push_back(std::move(chunk));
+    m_ready.notify_one();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void TraceWriter::drain(void)
+{
+    while (true) {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_ready.wait(lock, [this] {
+            return (!m_queue.empty() || m_stopping);
+        });
+        if (m_queue.empty())
+            return;
+        Chunk chunk = std::move(m_queue.front());
+        m_queue.pop_front();
+        lock.unlock();
+        m_room.notify_one();
+
+        m_index.push_back({chunk.first, chunk.last, m_offset,
+            chunk.bytes.size()});
+        write(chunk.bytes.data(), chunk.bytes.size());
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void TraceWriter::write(const void* data, size_t size)
+{
+    if (std::fwrite(data, 1, size, m_file) != size) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_failed = true;
+    }
+    m_offset += size;
+}
+
+} // namespace nts
@@ -0,0 +1,160 @@
+///////////////////////////////////////////////////////////////////////////////
+// Header guard
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "ITraceWriter.hpp"
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace nts
+///////////////////////////////////////////////////////////////////////////////
+namespace nts
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Record pin values to a compact binary trace
+///
+/// Layout, integers in host byte order:
+/// - header: `MAGIC`, u32 `VERSION`, u32 signal count, then per signal a
+///   u32 length and its name;
+/// - chunks, each covering a range of ticks: the values entering the chunk,
+///   two bits per signal (Tristate::False, True, Undefined as 0, 1, 2), a
+///   varint count of signals that changed, then per signal a varint index
+///   gap from the previous one, a varint change count and one varint per
+///   change, `(tick delta << 2) | value`, ticks counted from the chunk's
+///   first tick then from the previous change;
+/// - index: per chunk u64 first tick, last tick, offset and size;
+/// - trailer: u64 index offset, u64 chunk count, `INDEX_MAGIC`.
+///
+/// Each chunk is self-contained, so a reader can start at any of them. The
+/// sampling thread only encodes changes; sealed chunks are handed to a
+/// writer thread, which blocks sampling only when it falls `QUEUE` chunks
+/// behind.
+///
+///////////////////////////////////////////////////////////////////////////////
+class TraceWriter : public ITraceWriter
+{
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    // Format constants
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr char MAGIC[8] = {'N', 'T', 'S', 'T', 'R', 'A', 'C', 'E'};
+    static constexpr char INDEX_MAGIC[8] = {'N', 'T', 'S', 'I', 'N', 'D',
+        'E', 'X'};
+    static constexpr uint32_t VERSION = 1;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Location of a chunk in the file
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct IndexEntry
+    {
+        uint64_t first;             //<! First tick
+        uint64_t last;              //<! Last tick
+        uint64_t offset;            //<!
+        uint64_t size;              //<!
+    };
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief A sealed chunk waiting for the writer thread
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct Chunk
+    {
+        uint64_t first;             //<!
+        uint64_t last;              //<!
+        std::string bytes;          //<!
+    };
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    // Private properties
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr size_t CHUNK_BYTES = 1 << 18;  //<! Changes per chunk
+    static constexpr size_t CHUNK_TICKS = 1 << 16;  //<! Seek granularity
+    static constexpr size_t QUEUE = 8;              //<! Chunks in flight
+    std::vector<Signal> m_signals;                  //<!
+    std::vector<uint8_t> m_values;                  //<! Current, 0 to 2
+    std::vector<uint8_t> m_entry;                   //<! Entering the chunk
+    std::vector<std::string> m_changes;             //<! Encoded per signal
+    std::vector<uint32_t> m_counts;                 //<! Changes per signal
+    std::vector<uint64_t> m_lastTicks;              //<! Previous change
+    size_t m_bytes{0};                              //<! Encoded so far
+    uint64_t m_first{0};                            //<! Chunk first tick
+    uint64_t m_last{0};                             //<! Chunk last tick
+    bool m_empty{true};                             //<! No tick sampled yet
+    FILE* m_file;                                   //<!
+    uint64_t m_offset{0};                           //<! Bytes written
+    std::vector<IndexEntry> m_index;                //<! Writer thread only
+    std::deque<Chunk> m_queue;                      //<!
+    std::mutex m_mutex;                             //<!
+    std::condition_variable m_ready;                //<! Queue not empty
+    std::condition_variable m_room;                 //<! Queue not full
+    bool m_stopping{false};                         //<!
+    bool m_failed{false};                           //<! A write failed
+    std::thread m_thread;                           //<!
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Create the file, write the header and start the writer thread
+    ///
+    /// \param filename
+    /// \param signals
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    TraceWriter(const std::string& filename, std::vector<Signal> signals);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Seal the last chunk, wait for the writer and write the index
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    ~TraceWriter() override;
+
+    TraceWriter(const TraceWriter&) = delete;
+    TraceWriter& operator=(const TraceWriter&) = delete;
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param tick
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void sample(size_t tick) override;
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Queue the current chunk and start an empty one
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void seal(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Writer thread body
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void drain(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param data
+    /// \param size
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void write(const void* data, size_t size);
+};
+
+} // namespace nts
@@ -0,0 +1,100 @@
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "VcdWriter.hpp"
+#include <charconv>
+#include <limits>
+#include <stdexcept>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace nts
+///////////////////////////////////////////////////////////////////////////////
+namespace nts
+{
+
+///////////////////////////////////////////////////////////////////////////////
+static std::string identifier(size_t index)
+{
+    static const char FIRST = '!';
+    static const size_t RANGE = '~' - '!' + 1;
+    std::string code;
+
+    do {
+        code += static_cast<char>(FIRST + index % RANGE);
+        index /= RANGE;
+    } while (index != 0);
+    return (code);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+static char toVcd(Tristate value)
+{
+    switch (value) {
+        case Tristate::True:    return ('1');
+        case Tristate::False:   return ('0');
+        default:                return ('x');
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+VcdWriter::VcdWriter(const std::string& filename, std::vector<Signal> signals)
+    : m_file(filename, std::ios::binary)
+    , m_signals(std::move(signals))
+    , m_values(m_signals.size(), '\0')
+{
+    if (!m_file.is_open())
+        throw std::runtime_error("Cannot create " + filename);
+    m_buffer.reserve(CAPACITY + 4096);
+    m_buffer += "$timescale 1 ns $end\n$scope module circuit $end\n";
+    for (size_t i = 0; i < m_signals.size(); i++) {
+        m_codes.push_back(identifier(i));
+        m_buffer += "$var wire 1 " + m_codes[i] + " " + m_signals[i].name
+            + " $end\n";
+    }
+    m_buffer += "$upscope $end\n$enddefinitions $end\n";
+}
+
+///////////////////////////////////////////////////////////////////////////////
+VcdWriter::~VcdWriter()
+{
+    flush();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void VcdWriter::sample(size_t tick)
+{
+    bool stamped = false;
+
+    for (size_t i = 0; i < m_signals.size(); i++) {
+        const Signal& signal = m_signals[i];
+        char value = toVcd(signal.component->compute(signal.pin));
+
+        if (value == m_values[i])
+            continue;
+        if (!stamped) {
+            char digits[std::numeric_limits<size_t>::digits10 + 1];
+            auto result = std::to_chars(digits, digits + sizeof(digits), tick);
+
+            m_buffer += '#';
+            m_buffer.append(digits, result.ptr);
+            m_buffer += '\n';
+            stamped = true;
+        }
+        m_buffer += value;
+        m_buffer += m_codes[i];
+        m_buffer += '\n';
+        m_values[i] = value;
+    }
+    if (m_buffer.size() >= CAPACITY)
+        flush();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void VcdWriter::flush(void)
+{
+    m_file.write(m_buffer.data(), m_buffer.size());
+    m_file.flush();
+    m_buffer.clear();
+}
+
+} // namespace nts
@@ -0,0 +1,74 @@
+///////////////////////////////////////////////////////////////////////////////
+// Header guard
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "ITraceWriter.hpp"
+#include <fstream>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace nts
+///////////////////////////////////////////////////////////////////////////////
+namespace nts
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Stream pin values to a Value Change Dump file
+///
+/// Every signal is a one-bit wire, undefined values are written as `x` and
+/// one tick is one time unit. Only values that changed since the previous
+/// sample are recorded. Records are formatted into a large buffer that is
+/// written out once full, and when the writer is destroyed.
+///
+///////////////////////////////////////////////////////////////////////////////
+class VcdWriter : public ITraceWriter
+{
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    // Private properties
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr size_t CAPACITY = 1 << 20;     //<! Bytes before a write
+    std::ofstream m_file;                           //<!
+    std::vector<Signal> m_signals;                  //<!
+    std::vector<std::string> m_codes;               //<! VCD identifiers
+    std::vector<char> m_values;                     //<! Last written
+    std::string m_buffer;                           //<!
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Create the file and write the declarations
+    ///
+    /// \param filename
+    /// \param signals
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    VcdWriter(const std::string& filename, std::vector<Signal> signals);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Write what is left in the buffer
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    ~VcdWriter() override;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param tick
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void sample(size_t tick) override;
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void flush(void);
+};
+
+} // namespace nts
@@ -0,0 +1,102 @@
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Snapshot.hpp"
+#include <cstdint>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace nts
+///////////////////////////////////////////////////////////////////////////////
+namespace nts
+{
+
+///////////////////////////////////////////////////////////////////////////////
+Snapshot::Snapshot(std::string bytes)
+    : m_bytes(std::move(bytes))
+{}
+
+///////////////////////////////////////////////////////////////////////////////
+void Snapshot::setTimeless(size_t tick)
+{
+    m_timeless = true;
+    m_tick = tick;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Snapshot::writeTick(size_t tick)
+{
+    if (!m_timeless)
+        write(tick);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+size_t Snapshot::readTick(void)
+{
+    return (m_timeless ? m_tick : read<size_t>());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool Snapshot::isConsumed(void) const
+{
+    return (m_position == m_bytes.size());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Snapshot::clear(void)
+{
+    m_bytes.clear();
+    m_position = 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+const std::string& Snapshot::getBytes(void) const
+{
+    return (m_bytes);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+const char* Snapshot::take(size_t size)
+{
+    if (size > m_bytes.size() - m_position)
+        throw std::runtime_error("Truncated state file");
+    m_position += size;
+    return (m_bytes.data() + m_position - size);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template<>
+void Snapshot::write<Tristate>(const Tristate& value)
+{
+    write(static_cast<int8_t>(value));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template<>
+Tristate Snapshot::read<Tristate>(void)
+{
+    int8_t value = read<int8_t>();
+
+    if (value != Tristate::True && value != Tristate::False
+        && value != Tristate::Undefined)
+        throw std::runtime_error("Invalid state file");
+    return (static_cast<Tristate>(value));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template<>
+void Snapshot::write<std::string>(const std::string& value)
+{
+    write(static_cast<uint32_t>(value.size()));
+    m_bytes += value;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template<>
+std::string Snapshot::read<std::string>(void)
+{
+    uint32_t size = read<uint32_t>();
+
+    return (std::string(take(size), size));
+}
+
+} // namespace nts
@@ -0,0 +1,165 @@
+///////////////////////////////////////////////////////////////////////////////
+// Header guard
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Tristate.hpp"
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace nts
+///////////////////////////////////////////////////////////////////////////////
+namespace nts
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Byte buffer holding the dynamic state of a circuit
+///
+/// Values are stored back to back in host byte order, with no tags: a
+/// component reads back exactly what it wrote, in the same order. Tristates
+/// take one byte and strings are prefixed by their u32 length.
+///
+///////////////////////////////////////////////////////////////////////////////
+class Snapshot
+{
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    // Private properties
+    ///////////////////////////////////////////////////////////////////////////
+    std::string m_bytes;        //<!
+    size_t m_position{0};       //<! Next byte to read
+    bool m_timeless{false};     //<! Component ticks are left out
+    size_t m_tick{0};           //<! Read back for them when timeless
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Empty snapshot, to write into
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Snapshot(void) = default;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Snapshot to read from
+    ///
+    /// \param bytes
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    explicit Snapshot(std::string bytes);
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \tparam T Trivially copyable type, Tristate or std::string
+    /// \param value
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    template<typename T>
+    void write(const T& value)
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        m_bytes.append(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \tparam T Trivially copyable type, Tristate or std::string
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    template<typename T>
+    T read(void)
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        T value;
+        std::memcpy(&value, take(sizeof(T)), sizeof(T));
+        return (value);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Leave out the last tick each component simulated
+    ///
+    /// The tick moves on every tick without being state of its own, so
+    /// comparing or hashing snapshots needs it gone. Components loaded from
+    /// a timeless snapshot get the given tick instead.
+    ///
+    /// \param tick
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void setTimeless(size_t tick);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Write the last tick a component simulated, unless timeless
+    ///
+    /// \param tick
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void writeTick(size_t tick);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Read back what writeTick wrote
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    size_t readTick(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Tell if every byte was read
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    bool isConsumed(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Drop every byte, keeping the allocation for the next write
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void clear(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    const std::string& getBytes(void) const;
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Consume bytes, throwing if the snapshot is too short
+    ///
+    /// \param size
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    const char* take(size_t size);
+};
+
+///////////////////////////////////////////////////////////////////////////////
+template<>
+void Snapshot::write<Tristate>(const Tristate& value);
+
+///////////////////////////////////////////////////////////////////////////////
+template<>
+Tristate Snapshot::read<Tristate>(void);
+
+///////////////////////////////////////////////////////////////////////////////
+template<>
+void Snapshot::write<std::string>(const std::string& value);
+
+///////////////////////////////////////////////////////////////////////////////
+template<>
+std::string Snapshot::read<std::string>(void);
+
+} // namespace nts
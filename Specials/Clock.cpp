@@ -3,6 +3,7 @@
 ///////////////////////////////////////////////////////////////////////////////
 #include "Clock.hpp"
 #include "Errors/OutOfRangePinException.hpp"
+#include "Snapshot.hpp"
 
 ///////////////////////////////////////////////////////////////////////////////
 // Namespace nts::Specials
@@ -30,13 +31,15 @@ void Clock::simulate(size_t tick)
 {
     if (m_tick == tick)
         return;
-    m_tick = tick;
+    AComponent::simulate(tick);
     if (m_valueWasSet) {
-        m_valueWasSet = false;
+        store(m_valueWasSet, false);
         return;
     }
-    if (m_pins[0].getState() != Tristate::Undefined)
+    if (m_pins[0].getState() != Tristate::Undefined) {
         m_pins[0].setState(~(m_pins[0].getState()));
+        m_changed = true;
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -47,4 +50,32 @@ Tristate Clock::compute(size_t pin)
     return (m_pins[0].getState());
 }
 
+///////////////////////////////////////////////////////////////////////////////
+void Clock::setPattern(const Tristate64& pattern)
+{
+    m_pattern = pattern;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Tristate64 Clock::compute64(size_t pin)
+{
+    if (pin >= m_pins.size())
+        throw OutOfRangePinException();
+    return (m_pattern);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Clock::saveState(Snapshot& snapshot) const
+{
+    AComponent::saveState(snapshot);
+    snapshot.write(m_valueWasSet);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Clock::loadState(Snapshot& snapshot)
+{
+    AComponent::loadState(snapshot);
+    m_valueWasSet = snapshot.read<bool>();
+}
+
 } // namespace nts::Specials
@@ -25,6 +25,7 @@ private:
     //
     ///////////////////////////////////////////////////////////////////////////
     bool m_valueWasSet;
+    Tristate64 m_pattern;
 
 public:
     ///////////////////////////////////////////////////////////////////////////
@@ -44,6 +45,14 @@ public:
     ///////////////////////////////////////////////////////////////////////////
     void setValue(Tristate value);
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Set the 64 values driven in bit-parallel mode
+    ///
+    /// \param pattern
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void setPattern(const Tristate64& pattern);
+
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
     ///
@@ -61,6 +70,32 @@ public:
     ///
     ///////////////////////////////////////////////////////////////////////////
     Tristate compute(size_t pin) override;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param pin
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Tristate64 compute64(size_t pin) override;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param snapshot
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void saveState(Snapshot& snapshot) const override;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param snapshot
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void loadState(Snapshot& snapshot) override;
 };
 
 } // namespace nts::Specials
@@ -26,4 +26,12 @@ Tristate False::compute(size_t pin)
     return (Tristate::False);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+Tristate64 False::compute64(size_t pin)
+{
+    if (pin >= m_pins.size())
+        throw OutOfRangePinException();
+    return (Tristate64(Tristate::False));
+}
+
 } // namespace nts::Specials
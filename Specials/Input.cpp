@@ -31,4 +31,18 @@ Tristate Input::compute(size_t pin)
     return (m_pins[0].getState());
 }
 
+///////////////////////////////////////////////////////////////////////////////
+void Input::setPattern(const Tristate64& pattern)
+{
+    m_pattern = pattern;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Tristate64 Input::compute64(size_t pin)
+{
+    if (pin >= m_pins.size())
+        throw OutOfRangePinException();
+    return (m_pattern);
+}
+
 } // namespace nts::Specials
@@ -20,6 +20,12 @@ namespace nts::Specials
 ///////////////////////////////////////////////////////////////////////////////
 class Input : public AComponent
 {
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    // Private properties
+    ///////////////////////////////////////////////////////////////////////////
+    Tristate64 m_pattern;       //<!
+
 public:
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
@@ -38,6 +44,14 @@ public:
     ///////////////////////////////////////////////////////////////////////////
     void setValue(Tristate value);
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Set the 64 values driven in bit-parallel mode
+    ///
+    /// \param pattern
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void setPattern(const Tristate64& pattern);
+
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
     ///
@@ -47,6 +61,16 @@ public:
     ///
     ///////////////////////////////////////////////////////////////////////////
     Tristate compute(size_t pin) override;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param pin
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Tristate64 compute64(size_t pin) override;
 };
 
 } // namespace nts::Specials
@@ -33,4 +33,12 @@ Tristate Output::compute(size_t pin)
     return (this->getInputState(0));
 }
 
+///////////////////////////////////////////////////////////////////////////////
+Tristate64 Output::compute64(size_t pin)
+{
+    if (pin >= m_pins.size())
+        throw OutOfRangePinException();
+    return (this->getInputState64(0));
+}
+
 } // namespace nts::Specials
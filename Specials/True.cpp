@@ -26,4 +26,12 @@ Tristate True::compute(size_t pin)
     return (Tristate::True);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+Tristate64 True::compute64(size_t pin)
+{
+    if (pin >= m_pins.size())
+        throw OutOfRangePinException();
+    return (Tristate64(Tristate::True));
+}
+
 } // namespace nts::Specials
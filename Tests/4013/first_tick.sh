@@ -0,0 +1,18 @@
+nts=Circuits/4013_flipflop.nts
+script=Tests/4013/first_tick.txt
+
+# The set of the first half and the clock edge of the second one must be
+# latched on the very first tick, as they are after an idle tick
+for engine in interpreted levelized event stealing bytecode; do
+    first=$(./nanotekspice --engine $engine $nts < $script | grep out_)
+    later=$( (echo simulate; cat $script) \
+        | ./nanotekspice --engine $engine $nts | grep out_)
+    expected=$(printf '  out_1_q: 0\n  out_1_qb: 1\n  out_2_q: 1\n  out_2_qb: 0')
+
+    if [ "$first" == "$expected" ] && [ "$later" == "$expected" ]; then
+        echo "Test PASSED ($engine)"
+    else
+        echo "Test FAILED - First 4013 tick differs with $engine"
+        diff <(echo "$expected") <(echo "$first")
+    fi
+done
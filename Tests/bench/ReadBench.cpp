@@ -0,0 +1,106 @@
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Shell/Circuit.hpp"
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+///////////////////////////////////////////////////////////////////////////////
+// Micro-benchmark of the engines: the 4008 adder chained STAGES times (sums
+// into the next A inputs, carry into the next carry in), simulated for about
+// a second per engine. Build with `make bench`.
+///////////////////////////////////////////////////////////////////////////////
+static constexpr size_t STAGES = 64;
+
+///////////////////////////////////////////////////////////////////////////////
+static std::string stage(size_t index)
+{
+    return ("add" + std::to_string(index));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+static void buildChain(nts::Circuit& circuit)
+{
+    static const size_t A[] = {7, 5, 3, 1};
+    static const size_t B[] = {6, 4, 2, 15};
+    static const size_t S[] = {10, 11, 12, 13};
+
+    for (size_t i = 0; i < 4; i++) {
+        circuit.addComponent("input", "a" + std::to_string(i));
+        circuit.addComponent("input", "b" + std::to_string(i));
+        circuit.addComponent("output", "s" + std::to_string(i));
+    }
+    circuit.addComponent("input", "cin");
+    circuit.addComponent("output", "cout");
+    for (size_t k = 0; k < STAGES; k++)
+        circuit.addComponent("4008", stage(k));
+
+    for (size_t k = 0; k < STAGES; k++) {
+        for (size_t i = 0; i < 4; i++) {
+            if (k == 0)
+                circuit.setLink("a" + std::to_string(i), 0, stage(k), A[i] - 1);
+            else
+                circuit.setLink(stage(k - 1), S[i] - 1, stage(k), A[i] - 1);
+            circuit.setLink("b" + std::to_string(i), 0, stage(k), B[i] - 1);
+        }
+        if (k == 0)
+            circuit.setLink("cin", 0, stage(k), 8);
+        else
+            circuit.setLink(stage(k - 1), 13, stage(k), 8);
+    }
+    for (size_t i = 0; i < 4; i++)
+        circuit.setLink("s" + std::to_string(i), 0, stage(STAGES - 1), S[i] - 1);
+    circuit.setLink("cout", 0, stage(STAGES - 1), 13);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+static void run(const std::string& engine)
+{
+    using Clock = std::chrono::steady_clock;
+    nts::Circuit circuit;
+    size_t ticks = 0;
+
+    circuit.setEngine(engine);
+    buildChain(circuit);
+    circuit.compile();
+
+    size_t evaluations = circuit.getEvaluations();
+    auto start = Clock::now();
+    std::chrono::duration<double> elapsed{0};
+    while (elapsed.count() < 1.0) {
+        for (size_t i = 0; i < 4; i++) {
+            circuit.setValue("a" + std::to_string(i),
+                (ticks >> i) & 1 ? nts::Tristate::True : nts::Tristate::False);
+            circuit.setValue("b" + std::to_string(i),
+                (ticks >> (i + 1)) & 1 ? nts::Tristate::True : nts::Tristate::False);
+        }
+        circuit.simulate();
+        ticks++;
+        elapsed = Clock::now() - start;
+    }
+
+    double seconds = elapsed.count();
+    evaluations = circuit.getEvaluations() - evaluations;
+    std::cout << engine << ": "
+              << static_cast<size_t>(ticks / seconds) << " ticks/s, "
+              << evaluations / ticks << " evaluations/tick"
+              << std::endl;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    if (argc > 1) {
+        for (int i = 1; i < argc; i++)
+            run(argv[i]);
+        return (EXIT_SUCCESS);
+    }
+    run("interpreted");
+    run("levelized");
+    run("event");
+    run("stealing");
+    run("bytecode");
+    return (EXIT_SUCCESS);
+}
@@ -0,0 +1,18 @@
+nts=Circuits/4801_ram.nts
+script=Tests/event/ram_failure.txt
+
+# The second tick fails while writing to the RAM: the event engine must not
+# keep its half-processed worklist or its stale latches afterwards
+expected=$(./nanotekspice --engine interpreted $nts < $script 2> /dev/null)
+event=$(./nanotekspice --engine event $nts < $script 2> report.txt)
+
+echo "Event engine errors:"
+cat report.txt
+rm -f report.txt
+
+if [ "$expected" == "$event" ]; then
+    echo "Test PASSED"
+else
+    echo "Test FAILED - The event engine displays differently after a failure"
+    diff <(echo "$expected") <(echo "$event")
+fi
@@ -0,0 +1,19 @@
+nts=Tests/fastforward/divider.nts
+script=Tests/fastforward/divider.txt
+
+expected=$(./nanotekspice --script $script $nts)
+skipped=$(./nanotekspice --fast-forward --script $script $nts 2> report.txt)
+
+echo "Fast-forward report:"
+cat report.txt
+
+# The 4013 state must repeat, whatever the ticks its flip-flops hold
+if ! grep -q "ticks skipped" report.txt; then
+    echo "Test FAILED - No tick was skipped"
+elif [ "$expected" == "$skipped" ]; then
+    echo "Test PASSED"
+else
+    echo "Test FAILED - Fast-forward displays differently"
+    diff <(echo "$expected") <(echo "$skipped")
+fi
+rm -f report.txt
@@ -0,0 +1,19 @@
+for circuit in folding duplicates; do
+    nts=Tests/optimize/$circuit.nts
+    script=Tests/optimize/$circuit.txt
+
+    expected=$(./nanotekspice $nts < $script)
+    optimized=$(./nanotekspice --optimize $nts < $script 2> report.txt)
+
+    echo "Optimizer report for $circuit:"
+    cat report.txt
+    rm -f report.txt
+
+    # Compare with the unoptimized run
+    if [ "$expected" == "$optimized" ]; then
+        echo "Test PASSED"
+    else
+        echo "Test FAILED - Optimized $circuit displays differently"
+        diff <(echo "$expected") <(echo "$optimized")
+    fi
+done
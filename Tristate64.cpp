@@ -0,0 +1,81 @@
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Tristate64.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace nts
+///////////////////////////////////////////////////////////////////////////////
+namespace nts
+{
+
+///////////////////////////////////////////////////////////////////////////////
+Tristate64::Tristate64(void)
+    : value(0)
+    , defined(0)
+{}
+
+///////////////////////////////////////////////////////////////////////////////
+Tristate64::Tristate64(Tristate state)
+    : value(state == Tristate::True ? ~uint64_t(0) : 0)
+    , defined(state == Tristate::Undefined ? 0 : ~uint64_t(0))
+{}
+
+///////////////////////////////////////////////////////////////////////////////
+Tristate64::Tristate64(uint64_t value, uint64_t defined)
+    : value(value & defined)
+    , defined(defined)
+{}
+
+///////////////////////////////////////////////////////////////////////////////
+Tristate Tristate64::get(size_t lane) const
+{
+    if (!((defined >> lane) & 1))
+        return (Tristate::Undefined);
+    return ((value >> lane) & 1 ? Tristate::True : Tristate::False);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Tristate64::set(size_t lane, Tristate state)
+{
+    uint64_t bit = uint64_t(1) << lane;
+
+    value &= ~bit;
+    defined &= ~bit;
+    if (state != Tristate::Undefined)
+        defined |= bit;
+    if (state == Tristate::True)
+        value |= bit;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Tristate64 operator~(const Tristate64& state)
+{
+    return (Tristate64(~state.value, state.defined));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Tristate64 operator&(const Tristate64& lhs, const Tristate64& rhs)
+{
+    uint64_t zero = (lhs.defined & ~lhs.value) | (rhs.defined & ~rhs.value);
+    uint64_t one = lhs.value & rhs.value;
+
+    return (Tristate64(one, zero | one));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Tristate64 operator|(const Tristate64& lhs, const Tristate64& rhs)
+{
+    uint64_t one = lhs.value | rhs.value;
+    uint64_t zero = (lhs.defined & ~lhs.value) & (rhs.defined & ~rhs.value);
+
+    return (Tristate64(one, zero | one));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Tristate64 operator^(const Tristate64& lhs, const Tristate64& rhs)
+{
+    return (Tristate64(lhs.value ^ rhs.value, lhs.defined & rhs.defined));
+}
+
+} // namespace nts
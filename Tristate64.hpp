@@ -0,0 +1,134 @@
+///////////////////////////////////////////////////////////////////////////////
+// Header guard
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Tristate.hpp"
+#include <cstddef>
+#include <cstdint>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace nts
+///////////////////////////////////////////////////////////////////////////////
+namespace nts
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief 64 independent Tristate lanes packed as two bitplanes
+///
+/// A lane is Undefined when its bit is clear in `defined`, otherwise its
+/// value is the bit in `value`. Undefined lanes always keep a clear value
+/// bit so two equal vectors compare equal. The operators follow the same
+/// truth tables as the scalar Tristate ones, one lane per bit.
+///
+///////////////////////////////////////////////////////////////////////////////
+struct Tristate64
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // Number of lanes
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr size_t LANES = 64;
+
+    uint64_t value;             //<!
+    uint64_t defined;           //<!
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Every lane Undefined
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Tristate64(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Every lane set to the same state
+    ///
+    /// \param state
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Tristate64(Tristate state);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param value
+    /// \param defined
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Tristate64(uint64_t value, uint64_t defined);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param lane
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Tristate get(size_t lane) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param lane
+    /// \param state
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void set(size_t lane, Tristate state);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param other
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    bool operator==(const Tristate64& other) const = default;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param state
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+Tristate64 operator~(const Tristate64& state);
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param lhs
+/// \param rhs
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+Tristate64 operator&(const Tristate64& lhs, const Tristate64& rhs);
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param lhs
+/// \param rhs
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+Tristate64 operator|(const Tristate64& lhs, const Tristate64& rhs);
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param lhs
+/// \param rhs
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+Tristate64 operator^(const Tristate64& lhs, const Tristate64& rhs);
+
+} // namespace nts